@@ -44,6 +44,10 @@
  * - 파일 스트림: ifstream, ofstream, fstream
  * - 바이너리 vs 텍스트 모드
  * - 파일 시스템 API: filesystem 라이브러리 (C++17)
+ * - 메모리 매핑: 파일을 주소 공간에 올려 복사 없이 string_view로 읽기
+ * - 대량 쓰기: 줄을 큰 버퍼에 모아 한 번에 write (내구성이 필요하면 fdatasync)
+ * - 커널 복사: copy_file_range/sendfile로 사용자 공간을 거치지 않고 바이트 그대로 복사
+ * - 병렬 처리: 줄 경계로 나눈 청크를 여러 스레드가 처리하고 결과를 병합
  * - 에러 코드 vs 예외: 각각의 장단점
  * 
  * 주의사항:
@@ -58,22 +62,555 @@
 #include <string>
 #include <vector>
 #include <stdexcept>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <cstdlib>
+#include <cerrno>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#if defined(__unix__) || defined(__APPLE__)
+    #define FILE_IO_POSIX 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+#ifdef __linux__
+    #include <sys/sendfile.h>
+#endif
 using namespace std;
 
-class FileManager {
+// 읽기 전용 메모리 매핑 파일 (RAII)
+// POSIX에서는 mmap, 그 외에는 해당 구간을 한 번에 읽어 같은 인터페이스를 제공한다.
+class MappedFile {
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+    uint64_t totalSize = 0;     // 파일 전체 크기
+    vector<char> fallback;
+#ifdef FILE_IO_POSIX
+    void* mapping = nullptr;
+    size_t mappingLength = 0;
+#endif
+
+    void release() {
+#ifdef FILE_IO_POSIX
+        if (mapping) ::munmap(mapping, mappingLength);
+        mapping = nullptr;
+#endif
+        bytes = nullptr;
+        length = 0;
+    }
+
 public:
-    static void writeFile(const string& filename, const vector<string>& lines) {
-        ofstream file(filename);
+    MappedFile() = default;
+
+    // 파일의 [offset, offset + maxLength) 구간을 매핑 (기본값은 파일 전체)
+    explicit MappedFile(const string& filename, uint64_t offset = 0, size_t maxLength = SIZE_MAX) {
+#ifdef FILE_IO_POSIX
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw runtime_error("파일을 열 수 없습니다: " + filename);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+        }
+        totalSize = static_cast<uint64_t>(info.st_size);
+        if (offset < totalSize) {
+            // mmap 오프셋은 페이지 경계여야 하므로 앞쪽을 조금 더 매핑한다
+            static const uint64_t pageSize = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+            uint64_t aligned = offset - offset % pageSize;
+            length = static_cast<size_t>(min<uint64_t>(maxLength, totalSize - offset));
+            mappingLength = length + static_cast<size_t>(offset - aligned);
+            mapping = ::mmap(nullptr, mappingLength, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(aligned));
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                ::close(fd);
+                throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+            }
+            ::madvise(mapping, mappingLength, MADV_SEQUENTIAL);
+            bytes = static_cast<const char*>(mapping) + (offset - aligned);
+        }
+        ::close(fd);
+#else
+        ifstream file(filename, ios::binary | ios::ate);
+        if (!file.is_open()) {
+            throw runtime_error("파일을 열 수 없습니다: " + filename);
+        }
+        totalSize = static_cast<uint64_t>(file.tellg());
+        if (offset < totalSize) {
+            length = static_cast<size_t>(min<uint64_t>(maxLength, totalSize - offset));
+            fallback.resize(length);
+            file.seekg(static_cast<streamoff>(offset));
+            if (!file.read(fallback.data(), static_cast<streamsize>(length))) {
+                throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+            }
+            bytes = fallback.data();
+        }
+#endif
+    }
+
+    ~MappedFile() { release(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(bytes, other.bytes);
+            swap(length, other.length);
+            swap(totalSize, other.totalSize);
+            swap(fallback, other.fallback);
+#ifdef FILE_IO_POSIX
+            swap(mapping, other.mapping);
+            swap(mappingLength, other.mappingLength);
+#endif
+        }
+        return *this;
+    }
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+    uint64_t fileSize() const { return totalSize; }
+    string_view view() const { return string_view(bytes, length); }
+};
+
+// 대량 쓰기 정책: 처리량과 내구성 사이의 선택
+struct WritePolicy {
+    size_t bufferSize = 1 << 20;    // 이만큼 모아서 한 번에 write
+    bool directIO = false;          // O_DIRECT: 페이지 캐시를 거치지 않음 (지원하지 않는 파일 시스템이면 일반 쓰기)
+    bool syncData = false;          // 닫기 전에 fdatasync로 디스크 기록까지 보장
+};
+
+// 줄 단위 대량 쓰기 (RAII)
+// 줄을 정렬된 큰 버퍼에 모아 버퍼가 찰 때만 write하고, 버퍼보다 긴 줄은 writev로 복사 없이 보낸다.
+// 오류는 writeFile과 같은 runtime_error 메시지로 알린다.
+// 파일 권한(0666 & ~umask)과 줄바꿈(비 POSIX에서는 텍스트 모드)도 writeFile과 같다.
+class BulkWriter {
+public:
+    static constexpr size_t Alignment = 4096;  // O_DIRECT 버퍼/크기 정렬 단위
+
+private:
+    WritePolicy policy;
+    size_t capacity;
+    size_t used = 0;
+    size_t syscalls = 0;        // write/writev/fdatasync 호출 수
+#ifdef FILE_IO_POSIX
+    int fd = -1;
+    bool direct = false;
+    unique_ptr<char, decltype(&free)> buffer{nullptr, &free};
+#else
+    ofstream file;
+    vector<char> fallback;
+    char* bufferData = nullptr;
+#endif
+
+    char* data() {
+#ifdef FILE_IO_POSIX
+        return buffer.get();
+#else
+        return bufferData;
+#endif
+    }
+
+    [[noreturn]] static void fail() {
+        throw runtime_error("파일 쓰기 중 오류가 발생했습니다.");
+    }
+
+#ifdef FILE_IO_POSIX
+    // 부분 쓰기와 EINTR을 처리하며 iov 전체를 기록
+    void writeAll(iovec* iov, int count) {
+        while (count > 0) {
+            ssize_t written = ::writev(fd, iov, count);
+            syscalls++;
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                fail();
+            }
+            size_t remaining = static_cast<size_t>(written);
+            while (count > 0 && remaining >= iov->iov_len) {
+                remaining -= iov->iov_len;
+                iov++;
+                count--;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + remaining;
+                iov->iov_len -= remaining;
+            }
+        }
+    }
+#endif
+
+    void flushBuffer() {
+        if (used == 0) return;
+#ifdef FILE_IO_POSIX
+        iovec iov{data(), used};
+        writeAll(&iov, 1);
+#else
+        file.write(data(), static_cast<streamsize>(used));
+        syscalls++;
+        if (file.fail()) fail();
+#endif
+        used = 0;
+    }
+
+    void append(const char* bytes, size_t size) {
+        while (size > 0) {
+            size_t count = min(size, capacity - used);
+            memcpy(data() + used, bytes, count);
+            used += count;
+            bytes += count;
+            size -= count;
+            if (used == capacity) flushBuffer();
+        }
+    }
+
+public:
+    BulkWriter(const string& filename, const WritePolicy& writePolicy = WritePolicy())
+        : policy(writePolicy),
+          capacity(max<size_t>((writePolicy.bufferSize + Alignment - 1) / Alignment * Alignment, Alignment)) {
+#ifdef FILE_IO_POSIX
+        int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    #ifdef O_DIRECT
+        if (policy.directIO) {
+            fd = ::open(filename.c_str(), flags | O_DIRECT, 0666);
+            direct = fd >= 0;
+        }
+    #endif
+        if (fd < 0) fd = ::open(filename.c_str(), flags, 0666);    // ofstream과 같이 umask만 적용
+        if (fd < 0) {
+            throw runtime_error("파일을 생성할 수 없습니다: " + filename);
+        }
+        buffer.reset(static_cast<char*>(aligned_alloc(Alignment, capacity)));
+        if (!buffer) {
+            ::close(fd);
+            throw bad_alloc();
+        }
+#else
+        file.open(filename, ios::trunc);    // 텍스트 모드: Windows에서는 기존처럼 CRLF로 기록
         if (!file.is_open()) {
             throw runtime_error("파일을 생성할 수 없습니다: " + filename);
         }
+        fallback.resize(capacity);
+        bufferData = fallback.data();
+#endif
+    }
 
-        for (const auto& line : lines) {
-            file << line << endl;
-            if (file.fail()) {
+    // 오류를 알려야 하면 소멸자에 맡기지 말고 close를 직접 호출할 것
+    ~BulkWriter() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    BulkWriter(const BulkWriter&) = delete;
+    BulkWriter& operator=(const BulkWriter&) = delete;
+
+    void writeLine(string_view line) {
+#ifdef FILE_IO_POSIX
+        if (line.size() >= capacity / 2 && !direct) {
+            // 긴 줄: 모아 둔 버퍼, 줄 본문, 줄바꿈을 writev 한 번으로
+            iovec iov[3] = {
+                {data(), used},
+                {const_cast<char*>(line.data()), line.size()},
+                {const_cast<char*>("\n"), 1}
+            };
+            writeAll(iov, 3);
+            used = 0;
+            return;
+        }
+#endif
+        append(line.data(), line.size());
+        append("\n", 1);
+    }
+
+    // 남은 버퍼를 기록하고 (정책에 따라 fdatasync 후) 닫는다
+    void close() {
+#ifdef FILE_IO_POSIX
+        if (fd < 0) return;
+    #ifdef O_DIRECT
+        if (direct && used % Alignment != 0) {
+            // 블록 크기로 나누어떨어지지 않는 마지막 부분은 O_DIRECT를 끄고 기록
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_DIRECT);
+            direct = false;
+        }
+    #endif
+        int current = fd;
+        try {
+            flushBuffer();
+            if (policy.syncData) {
+    #ifdef __APPLE__
+                int synced = ::fsync(fd);
+    #else
+                int synced = ::fdatasync(fd);
+    #endif
+                syscalls++;
+                if (synced != 0) fail();
+            }
+        } catch (...) {
+            fd = -1;    // 소멸자에서 다시 닫지 않도록
+            ::close(current);
+            throw;
+        }
+        fd = -1;
+        if (::close(current) != 0) fail();
+#else
+        if (!file.is_open()) return;
+        flushBuffer();
+        file.close();
+        if (file.fail()) fail();
+#endif
+    }
+
+    bool isDirect() const {
+#ifdef FILE_IO_POSIX
+        return direct;
+#else
+        return false;
+#endif
+    }
+
+    size_t getSyscallCount() const { return syscalls; }
+};
+
+// 복사 진행 상황 콜백 (지금까지 복사한 바이트, 전체 바이트)
+using CopyProgress = function<void(uint64_t copied, uint64_t total)>;
+
+// 바이트 단위 그대로 복사 (줄바꿈, 바이너리 내용 모두 보존)
+// 리눅스에서는 커널 안에서 복사하고(copy_file_range, 안 되면 sendfile) 그 외에는 큰 버퍼로 read/write한다.
+// 메모리 사용량은 파일 크기와 상관없이 일정하다.
+class FileCopier {
+public:
+    static constexpr size_t ChunkSize = 64 << 20;   // 진행 상황 보고 단위
+    static constexpr size_t BufferSize = 1 << 20;   // read/write 경로 버퍼
+
+private:
+#ifdef FILE_IO_POSIX
+    struct Descriptor {
+        int fd;
+        ~Descriptor() { if (fd >= 0) ::close(fd); }
+    };
+
+    [[noreturn]] static void failWrite() {
+        throw runtime_error("파일 쓰기 중 오류가 발생했습니다.");
+    }
+
+    // 커널 복사. 이 파일 시스템 조합에서 지원하지 않으면 0을 반환하고 버퍼 복사에 맡긴다
+    static uint64_t kernelCopy(int in, int out, uint64_t total, const CopyProgress& progress) {
+        uint64_t copied = 0;
+    #ifdef __linux__
+        bool copyRange = true;
+        while (copied < total) {
+            size_t count = static_cast<size_t>(min<uint64_t>(ChunkSize, total - copied));
+            ssize_t n = copyRange ? ::copy_file_range(in, nullptr, out, nullptr, count, 0)
+                                  : ::sendfile(out, in, nullptr, count);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                bool unsupported = errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP;
+                if (unsupported && copied == 0) {
+                    if (!copyRange) return 0;
+                    copyRange = false;
+                    continue;
+                }
+                failWrite();
+            }
+            if (n == 0) break;      // 복사 중 원본이 줄어듦
+            copied += static_cast<uint64_t>(n);
+            if (progress) progress(copied, total);
+        }
+    #else
+        (void)in; (void)out; (void)total; (void)progress;
+    #endif
+        return copied;
+    }
+
+    // 남은 부분을 read/write로 복사 (파일 끝까지)
+    static uint64_t bufferCopy(int in, int out, uint64_t copied, uint64_t total, const CopyProgress& progress) {
+        unique_ptr<char[]> buffer(new char[BufferSize]);
+        uint64_t sinceReport = 0;
+        while (true) {
+            ssize_t n = ::read(in, buffer.get(), BufferSize);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+            }
+            if (n == 0) break;
+            for (ssize_t done = 0; done < n;) {
+                ssize_t written = ::write(out, buffer.get() + done, static_cast<size_t>(n - done));
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    failWrite();
+                }
+                done += written;
+            }
+            copied += static_cast<uint64_t>(n);
+            sinceReport += static_cast<uint64_t>(n);
+            if (progress && sinceReport >= ChunkSize) {
+                progress(copied, max(total, copied));
+                sinceReport = 0;
+            }
+        }
+        if (progress && sinceReport > 0) progress(copied, max(total, copied));
+        return copied;
+    }
+#endif
+
+public:
+    // 복사한 바이트 수 반환. 권한(모드)은 원본을 따른다 (대상이 이미 있어도, umask와 관계없이)
+    static uint64_t copy(const string& source, const string& destination, const CopyProgress& progress = nullptr) {
+        error_code ec;
+        if (filesystem::equivalent(source, destination, ec)) {
+            throw runtime_error("원본과 대상이 같은 파일입니다: " + destination);   // O_TRUNC로 원본이 지워지는 것 방지
+        }
+#ifdef FILE_IO_POSIX
+        Descriptor in{::open(source.c_str(), O_RDONLY)};
+        if (in.fd < 0) {
+            throw runtime_error("파일을 열 수 없습니다: " + source);
+        }
+        struct stat info;
+        if (::fstat(in.fd, &info) != 0) {
+            throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+        }
+        Descriptor out{::open(destination.c_str(), O_WRONLY | O_CREAT | O_TRUNC, info.st_mode & 0777)};
+        if (out.fd < 0) {
+            throw runtime_error("파일을 생성할 수 없습니다: " + destination);
+        }
+        // open의 모드는 새로 만들 때만 쓰이고 umask도 거치므로 직접 맞춘다
+        // (setuid 등 특수 비트를 줄 권한이 없으면 일반 권한 비트만)
+        if (::fchmod(out.fd, info.st_mode & 07777) != 0 && ::fchmod(out.fd, info.st_mode & 0777) != 0) {
+            throw runtime_error("파일 권한을 설정할 수 없습니다: " + destination);
+        }
+
+        uint64_t total = static_cast<uint64_t>(info.st_size);
+        uint64_t copied = kernelCopy(in.fd, out.fd, total, progress);
+        copied = bufferCopy(in.fd, out.fd, copied, total, progress);   // 대체 경로 겸 늘어난 부분 처리
+
+        int fd = out.fd;
+        out.fd = -1;
+        if (::close(fd) != 0) failWrite();
+        return copied;
+#else
+        ifstream in(source, ios::binary);
+        if (!in.is_open()) {
+            throw runtime_error("파일을 열 수 없습니다: " + source);
+        }
+        ofstream out(destination, ios::binary | ios::trunc);
+        if (!out.is_open()) {
+            throw runtime_error("파일을 생성할 수 없습니다: " + destination);
+        }
+
+        uint64_t total = filesystem::file_size(source, ec);
+        uint64_t copied = 0;
+        vector<char> buffer(BufferSize);
+        while (in.read(buffer.data(), static_cast<streamsize>(buffer.size())) || in.gcount() > 0) {
+            out.write(buffer.data(), in.gcount());
+            if (out.fail()) {
                 throw runtime_error("파일 쓰기 중 오류가 발생했습니다.");
             }
+            copied += static_cast<uint64_t>(in.gcount());
+            if (progress) progress(copied, max(total, copied));
+        }
+        if (in.bad()) {
+            throw runtime_error("파일 읽기 중 오류가 발생했습니다.");
+        }
+        out.close();
+        filesystem::permissions(destination, filesystem::status(source).permissions(), ec);
+        return copied;
+#endif
+    }
+
+    // 디렉토리 트리 복사: 디렉토리와 심볼릭 링크는 먼저 만들고, 파일은 threadCount개 작업자가 나눠 복사
+    // 진행 콜백에는 트리 전체 기준 바이트가 전달된다 (한 번에 한 스레드만 호출)
+    static uint64_t copyTree(const string& sourceDir, const string& destinationDir, size_t threadCount,
+                             const CopyProgress& progress = nullptr) {
+        namespace fs = filesystem;
+        if (!fs::is_directory(sourceDir)) {
+            throw runtime_error("디렉토리를 열 수 없습니다: " + sourceDir);
+        }
+
+        vector<pair<fs::path, fs::path>> files;
+        uint64_t total = 0;
+        fs::create_directories(destinationDir);
+        for (const auto& entry : fs::recursive_directory_iterator(sourceDir)) {
+            fs::path target = fs::path(destinationDir) / entry.path().lexically_relative(sourceDir);
+            if (entry.is_symlink()) {
+                error_code ec;
+                fs::remove(target, ec);
+                fs::copy_symlink(entry.path(), target);
+            } else if (entry.is_directory()) {
+                fs::create_directories(target);
+            } else if (entry.is_regular_file()) {
+                files.emplace_back(entry.path(), target);
+                total += entry.file_size();
+            }
+        }
+
+        atomic<size_t> nextFile{0};
+        atomic<bool> failed{false};
+        uint64_t copiedBytes = 0;
+        mutex progressMutex;        // copiedBytes, 콜백, firstError 보호
+        exception_ptr firstError;
+
+        auto worker = [&] {
+            while (!failed) {
+                size_t index = nextFile.fetch_add(1);
+                if (index >= files.size()) return;
+                uint64_t reported = 0;
+                try {
+                    copy(files[index].first.string(), files[index].second.string(),
+                         [&](uint64_t copied, uint64_t) {
+                             lock_guard<mutex> lock(progressMutex);
+                             copiedBytes += copied - reported;
+                             reported = copied;
+                             if (progress) progress(copiedBytes, total);
+                         });
+                } catch (...) {
+                    lock_guard<mutex> lock(progressMutex);
+                    if (!firstError) firstError = current_exception();
+                    failed = true;
+                }
+            }
+        };
+
+        size_t workerCount = max<size_t>(1, min(threadCount, files.size()));
+        vector<thread> workers;
+        for (size_t i = 1; i < workerCount; i++) workers.emplace_back(worker);
+        worker();   // 호출한 스레드도 작업자로 참여
+        for (auto& t : workers) t.join();
+
+        if (firstError) rethrow_exception(firstError);
+        return copiedBytes;
+    }
+};
+
+class FileManager {
+public:
+    // 줄을 큰 버퍼로 모아 한 번에 기록 (줄마다 flush하지 않음)
+    static void writeFile(const string& filename, const vector<string>& lines,
+                          const WritePolicy& policy = WritePolicy()) {
+        BulkWriter writer(filename, policy);
+        for (const auto& line : lines) {
+            writer.writeLine(line);
         }
+        writer.close();
 
         cout << "파일 쓰기 완료: " << filename << endl;
     }
@@ -99,16 +636,94 @@ public:
         return lines;
     }
 
-    static void copyFile(const string& source, const string& destination) {
+    // 복사 없는 줄 나누기: 반환된 string_view는 mapping이 살아 있는 동안 유효하다
+    // 줄 구분은 getline과 같다 (마지막 줄바꿈 뒤에는 빈 줄을 만들지 않음)
+    static vector<string_view> readLines(const MappedFile& mapping) {
+        vector<string_view> lines;
+        const char* cursor = mapping.data();
+        const char* end = cursor + mapping.size();
+        while (cursor < end) {
+            // memchr는 표준 라이브러리에서 SIMD로 구현되어 있다
+            const char* newline = static_cast<const char*>(memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+            if (!newline) newline = end;
+            lines.emplace_back(cursor, static_cast<size_t>(newline - cursor));
+            cursor = newline + 1;
+        }
+        return lines;
+    }
+
+    // 바이트 그대로 복사 (마지막 줄바꿈과 바이너리 내용도 보존)
+    static void copyFile(const string& source, const string& destination,
+                         const CopyProgress& progress = nullptr) {
         try {
-            auto content = readFile(source);
-            writeFile(destination, content);
+            FileCopier::copy(source, destination, progress);
             cout << "파일 복사 완료: " << source << " -> " << destination << endl;
         }
         catch (const exception& e) {
             throw runtime_error("파일 복사 실패: " + string(e.what()));
         }
     }
+
+    static void copyDirectory(const string& source, const string& destination,
+                              size_t threadCount = max(1u, thread::hardware_concurrency()),
+                              const CopyProgress& progress = nullptr) {
+        try {
+            uint64_t bytes = FileCopier::copyTree(source, destination, threadCount, progress);
+            cout << "디렉토리 복사 완료: " << source << " -> " << destination << " (" << bytes << "바이트)" << endl;
+        }
+        catch (const exception& e) {
+            throw runtime_error("디렉토리 복사 실패: " + string(e.what()));
+        }
+    }
+};
+
+// 대용량 파일용 줄 단위 스트리밍 읽기
+// 파일 전체가 아니라 chunkSize 크기의 구간만 매핑하고, 다 읽으면 다음 구간으로 옮긴다.
+// next가 돌려준 string_view는 다음 next 호출 전까지만 유효하다.
+class MappedLineReader {
+public:
+    static constexpr size_t DefaultChunkSize = 64 << 20;
+
+private:
+    string filename;
+    size_t chunkSize;
+    MappedFile window;
+    uint64_t windowOffset = 0;  // 현재 구간의 파일 내 시작 위치
+    size_t cursor = 0;          // 구간 안에서 다음 줄의 시작
+
+public:
+    explicit MappedLineReader(const string& fname, size_t chunk = DefaultChunkSize)
+        : filename(fname), chunkSize(max<size_t>(chunk, 4096)), window(fname, 0, chunkSize) {}
+
+    bool next(string_view& line) {
+        while (true) {
+            const char* begin = window.data() + cursor;
+            size_t remaining = window.size() - cursor;
+            const char* newline = remaining > 0
+                ? static_cast<const char*>(memchr(begin, '\n', remaining)) : nullptr;
+            if (newline) {
+                line = string_view(begin, static_cast<size_t>(newline - begin));
+                cursor += line.size() + 1;
+                return true;
+            }
+
+            if (windowOffset + window.size() >= window.fileSize()) {
+                // 파일 끝: 줄바꿈 없는 마지막 줄
+                if (remaining == 0) return false;
+                line = string_view(begin, remaining);
+                cursor = window.size();
+                return true;
+            }
+
+            // 구간 끝에 걸친 줄: 그 줄의 시작부터 다시 매핑 (한 줄이 구간보다 길면 구간을 늘림)
+            windowOffset += cursor;
+            window = MappedFile(filename, windowOffset, max(chunkSize, remaining * 2));
+            cursor = 0;
+        }
+    }
+
+    // 지금까지 읽은 바이트 수
+    uint64_t position() const { return windowOffset + cursor; }
 };
 
 // RAII를 사용한 안전한 파일 클래스
@@ -153,7 +768,481 @@ public:
     }
 };
 
-int main() {
+// 병렬 줄 처리 설정
+struct PipelineConfig {
+    size_t threadCount = max(1u, thread::hardware_concurrency());
+    size_t chunkSize = 4 << 20;     // 청크 목표 크기 (실제 경계는 다음 줄바꿈에 맞춤)
+    size_t maxInFlight = 0;         // 백프레셔: 나눴지만 아직 병합하지 않은 청크 수 상한 (0이면 threadCount * 2)
+    bool ordered = true;            // true면 청크 순서대로 병합, false면 끝나는 대로 병합 (순서 무관한 집계용)
+};
+
+// 사용자 함수가 던진 예외에 실패한 위치를 붙여 다시 던지는 예외
+class LineProcessingError : public runtime_error {
+private:
+    size_t chunk;
+    uint64_t lineNumber;
+    string line;
+
+public:
+    LineProcessingError(const string& message, size_t chunkIndex, uint64_t number, string text)
+        : runtime_error(message), chunk(chunkIndex), lineNumber(number), line(std::move(text)) {}
+
+    size_t getChunk() const { return chunk; }
+    uint64_t getLineNumber() const { return lineNumber; }     // 파일 전체 기준, 1부터
+    const string& getLine() const { return line; }
+};
+
+// 파일을 줄 경계에 맞춘 청크로 나눠 여러 스레드에서 줄 단위로 처리하는 파이프라인
+// 각 청크는 빈 Result에 onLine(result, line)으로 누적하고, merge(total, move(result))로 합친다.
+// 청크는 처리하는 작업자가 그때 매핑하고 끝나면 해제하므로, 메모리는 maxInFlight개 청크로 제한된다.
+// merge는 상태 잠금 밖에서 실행한다 (병합 중에도 청크 분배와 경계 찾기가 멈추지 않도록).
+// ordered: 한 번에 한 작업자만 순서가 맞은 결과들을 이어서 병합한다.
+// 순서 무관: 작업자마다 자기 누적값에 병합하고, 끝날 때 한 번만 total에 합친다.
+class LinePipeline {
+private:
+    struct Chunk {
+        size_t index;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    // offset 이후 첫 줄바꿈 다음 위치 (없으면 파일 끝)
+    static uint64_t findLineEnd(const string& filename, uint64_t offset, uint64_t fileSize) {
+        const size_t probeSize = 64 << 10;
+        while (offset < fileSize) {
+            MappedFile probe(filename, offset, probeSize);
+            const char* newline = static_cast<const char*>(memchr(probe.data(), '\n', probe.size()));
+            if (newline) return offset + static_cast<uint64_t>(newline - probe.data()) + 1;
+            offset += probe.size();
+        }
+        return fileSize;
+    }
+
+    // 실패 위치를 파일 전체 기준 줄 번호로 (실패했을 때만 앞부분 줄 수를 센다)
+    static uint64_t lineNumberAt(const string& filename, uint64_t chunkBegin, uint64_t lineInChunk) {
+        uint64_t lines = 0;
+        if (chunkBegin > 0) {
+            MappedFile before(filename, 0, static_cast<size_t>(chunkBegin));
+            lines = static_cast<uint64_t>(count(before.data(), before.data() + before.size(), '\n'));
+        }
+        return lines + lineInChunk + 1;
+    }
+
+    template<typename Result, typename LineFn>
+    static void processChunk(const string& filename, const Chunk& chunk, LineFn& onLine, Result& result) {
+        MappedFile mapping(filename, chunk.begin, static_cast<size_t>(chunk.end - chunk.begin));
+        const char* cursor = mapping.data();
+        const char* end = cursor + mapping.size();
+        uint64_t lineInChunk = 0;
+        while (cursor < end) {
+            const char* newline = static_cast<const char*>(memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+            if (!newline) newline = end;
+            string_view line(cursor, static_cast<size_t>(newline - cursor));
+            try {
+                onLine(result, line);
+            }
+            catch (const exception& e) {
+                uint64_t number = lineNumberAt(filename, chunk.begin, lineInChunk);
+                throw LineProcessingError("줄 처리 오류: " + filename + " " + to_string(number) + "번째 줄 (청크 " +
+                                          to_string(chunk.index) + "): " + e.what(),
+                                          chunk.index, number, string(line.substr(0, 256)));
+            }
+            lineInChunk++;
+            cursor = newline + 1;
+        }
+    }
+
+public:
+    template<typename Result, typename LineFn, typename MergeFn>
+    static Result run(const string& filename, LineFn onLine, MergeFn merge,
+                      const PipelineConfig& config = PipelineConfig()) {
+        error_code ec;
+        uint64_t fileSize = filesystem::file_size(filename, ec);
+        if (ec) {
+            throw runtime_error("파일을 열 수 없습니다: " + filename);
+        }
+
+        size_t threadCount = max<size_t>(config.threadCount, 1);
+        size_t chunkSize = max<size_t>(config.chunkSize, 1);
+        size_t maxInFlight = config.maxInFlight > 0 ? config.maxInFlight : threadCount * 2;
+
+        mutex stateMutex;
+        condition_variable workReady;   // 작업자: 청크가 생겼거나 끝남
+        condition_variable slotFree;    // 나누는 쪽: 처리 중인 청크 수가 줄었음
+        deque<Chunk> pending;
+        map<size_t, Result> waiting;    // ordered: 앞 청크를 기다리는 결과
+        size_t nextToMerge = 0;
+        bool merging = false;           // ordered: total에 병합 중인 작업자가 있음 (그 작업자만 total을 만짐)
+        size_t inFlight = 0;
+        bool producerDone = false;
+        exception_ptr firstError;
+        mutex totalMutex;               // 순서 무관: 작업자별 누적값을 total에 합칠 때
+        Result total{};
+
+        auto fail = [&](exception_ptr error) {
+            lock_guard<mutex> lock(stateMutex);
+            if (!firstError) firstError = error;
+            workReady.notify_all();
+            slotFree.notify_all();
+        };
+
+        // ordered: 순서가 맞은 결과를 잠금 안에서 꺼내고 잠금 밖에서 병합 (다른 작업자가 병합 중이면 맡김)
+        auto mergeReady = [&](size_t index, Result&& partial) {
+            vector<Result> batch;
+            unique_lock<mutex> lock(stateMutex);
+            waiting.emplace(index, std::move(partial));
+            if (merging) return;
+            merging = true;
+            while (true) {
+                while (!waiting.empty() && waiting.begin()->first == nextToMerge) {
+                    batch.push_back(std::move(waiting.begin()->second));
+                    waiting.erase(waiting.begin());
+                    nextToMerge++;
+                }
+                if (batch.empty()) break;
+
+                lock.unlock();
+                for (auto& result : batch) merge(total, std::move(result));
+                lock.lock();
+                inFlight -= batch.size();
+                batch.clear();
+                slotFree.notify_one();
+            }
+            merging = false;
+        };
+
+        auto worker = [&] {
+            Result local{};     // 순서 무관 모드의 작업자별 누적값
+            while (true) {
+                Chunk chunk;
+                {
+                    unique_lock<mutex> lock(stateMutex);
+                    workReady.wait(lock, [&] { return firstError || !pending.empty() || producerDone; });
+                    if (firstError) return;
+                    if (pending.empty()) break;
+                    chunk = pending.front();
+                    pending.pop_front();
+                }
+
+                try {
+                    Result partial{};
+                    processChunk(filename, chunk, onLine, partial);
+
+                    if (config.ordered) {
+                        mergeReady(chunk.index, std::move(partial));
+                    } else {
+                        merge(local, std::move(partial));
+                        lock_guard<mutex> lock(stateMutex);
+                        inFlight--;
+                        slotFree.notify_one();
+                    }
+                }
+                catch (...) {
+                    fail(current_exception());
+                    return;
+                }
+            }
+
+            if (!config.ordered) {
+                try {
+                    lock_guard<mutex> lock(totalMutex);
+                    merge(total, std::move(local));
+                }
+                catch (...) {
+                    fail(current_exception());
+                }
+            }
+        };
+
+        vector<thread> workers;
+        for (size_t i = 0; i < threadCount; i++) workers.emplace_back(worker);
+
+        // 호출한 스레드는 청크 경계만 찾아 넘긴다 (처리 중인 청크가 많으면 대기)
+        try {
+            uint64_t offset = 0;
+            for (size_t index = 0; offset < fileSize; index++) {
+                uint64_t end = fileSize - offset <= chunkSize ? fileSize
+                                                              : findLineEnd(filename, offset + chunkSize - 1, fileSize);
+                {
+                    unique_lock<mutex> lock(stateMutex);
+                    slotFree.wait(lock, [&] { return firstError || inFlight < maxInFlight; });
+                    if (firstError) break;
+                    pending.push_back(Chunk{index, offset, end});
+                    inFlight++;
+                }
+                workReady.notify_one();
+                offset = end;
+            }
+        }
+        catch (...) {
+            fail(current_exception());
+        }
+
+        {
+            lock_guard<mutex> lock(stateMutex);
+            producerDone = true;
+        }
+        workReady.notify_all();
+        for (auto& t : workers) t.join();
+
+        if (firstError) rethrow_exception(firstError);
+        return total;
+    }
+};
+
+// 벤치마크용 로그 파일 생성 (약 megabytes MB)
+void generateLogFile(const string& filename, size_t megabytes) {
+    ofstream out(filename, ios::binary);
+    string line;
+    uint64_t written = 0;
+    for (uint64_t i = 0; written < megabytes * (1ull << 20); i++) {
+        line = "2024-05-01 12:00:00 [INFO] request id=" + to_string(i) +
+               " path=/api/v1/items latency=" + to_string(i % 997) + "ms\n";
+        out.write(line.data(), static_cast<streamsize>(line.size()));
+        written += line.size();
+    }
+}
+
+// 줄 읽기 성능 비교: getline + vector<string> / 전체 매핑 + string_view / 구간 매핑 스트리밍
+// (megabytes에 5120을 주면 5GB 로그 기준. 파일을 만든 직후라 페이지 캐시에 올라간 상태로 측정된다)
+void benchmarkReadFile(const string& filename, size_t megabytes) {
+    generateLogFile(filename, megabytes);
+    double gigabytes = static_cast<double>(filesystem::file_size(filename)) / (1ull << 30);
+
+    auto measure = [&](const char* name, auto&& readAll) {
+        auto start = chrono::steady_clock::now();
+        size_t lineCount = readAll();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << name << " | " << lineCount << "줄 | " << gigabytes / seconds << " GB/s" << endl;
+    };
+
+    measure("getline + vector<string>", [&] { return FileManager::readFile(filename).size(); });
+    measure("mmap + string_view     ", [&] {
+        MappedFile mapping(filename);
+        return FileManager::readLines(mapping).size();
+    });
+    measure("구간 매핑 스트리밍     ", [&] {
+        MappedLineReader reader(filename);
+        string_view line;
+        size_t count = 0;
+        while (reader.next(line)) count++;
+        return count;
+    });
+
+    filesystem::remove(filename);
+}
+
+// 병렬 줄 처리: 줄 수 세기 / grep(순서 유지) / 단어 빈도를 스레드 수별로 측정
+void benchmarkPipeline(const string& filename, size_t megabytes) {
+    generateLogFile(filename, megabytes);
+    double size = static_cast<double>(filesystem::file_size(filename)) / (1 << 20);
+
+    for (size_t threads : {1, 2, 4, 8, 16}) {
+        PipelineConfig config;
+        config.threadCount = threads;
+
+        auto seconds = [](auto&& job) {
+            auto start = chrono::steady_clock::now();
+            job();
+            return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        };
+
+        config.ordered = false;
+        uint64_t lineCount = 0;
+        double countTime = seconds([&] {
+            lineCount = LinePipeline::run<uint64_t>(filename,
+                [](uint64_t& count, string_view) { count++; },
+                [](uint64_t& total, uint64_t&& count) { total += count; }, config);
+        });
+
+        config.ordered = true;     // 일치한 줄을 파일 순서대로 모음
+        vector<string> matches;
+        double grepTime = seconds([&] {
+            matches = LinePipeline::run<vector<string>>(filename,
+                [](vector<string>& found, string_view line) {
+                    if (line.find("latency=996ms") != string_view::npos) found.emplace_back(line);
+                },
+                [](vector<string>& all, vector<string>&& found) {
+                    all.insert(all.end(), make_move_iterator(found.begin()), make_move_iterator(found.end()));
+                }, config);
+        });
+
+        config.ordered = false;
+        unordered_map<string, uint64_t> frequency;
+        double wordTime = seconds([&] {
+            frequency = LinePipeline::run<unordered_map<string, uint64_t>>(filename,
+                [](unordered_map<string, uint64_t>& words, string_view line) {
+                    size_t start = 0;
+                    while (start < line.size()) {
+                        size_t space = line.find(' ', start);
+                        if (space == string_view::npos) space = line.size();
+                        if (space > start) words[string(line.substr(start, space - start))]++;
+                        start = space + 1;
+                    }
+                },
+                [](unordered_map<string, uint64_t>& all, unordered_map<string, uint64_t>&& words) {
+                    for (auto& [word, count] : words) all[word] += count;
+                }, config);
+        });
+
+        cout << threads << "스레드"
+             << " | 줄 수 " << lineCount << " (" << size / countTime << " MB/s)"
+             << " | grep " << matches.size() << "줄 (" << size / grepTime << " MB/s)"
+             << " | 단어 " << frequency.size() << "종 (" << size / wordTime << " MB/s)" << endl;
+    }
+    filesystem::remove(filename);
+}
+
+// 현재 프로세스의 write 계열 시스템 콜 누적 횟수 (리눅스 /proc/self/io, 없으면 -1)
+long long writeSyscallCount() {
+    ifstream io("/proc/self/io");
+    string key;
+    long long value;
+    while (io >> key >> value) {
+        if (key == "syscw:") return value;
+    }
+    return -1;
+}
+
+// 줄 쓰기 성능 비교: 줄마다 endl(flush) / 버퍼 모아 쓰기 / + fdatasync / + O_DIRECT
+void benchmarkWriteFile(const string& filename, size_t lineCount) {
+    vector<string> lines;
+    lines.reserve(lineCount);
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < lineCount; i++) {
+        lines.push_back("2024-05-01 12:00:00 [INFO] request id=" + to_string(i) + " path=/api/v1/items");
+        totalBytes += lines.back().size() + 1;
+    }
+
+    auto measure = [&](const char* name, auto&& writeAll) {
+        long long syscallsBefore = writeSyscallCount();
+        auto start = chrono::steady_clock::now();
+        writeAll();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        long long syscalls = writeSyscallCount() - syscallsBefore;
+        cout << name << " | " << totalBytes / seconds / (1 << 20) << " MB/s"
+             << " | write 시스템 콜 " << (syscallsBefore < 0 ? string("-") : to_string(syscalls)) << endl;
+        filesystem::remove(filename);
+    };
+
+    measure("줄마다 endl       ", [&] {
+        ofstream file(filename);
+        for (const auto& line : lines) {
+            file << line << endl;
+        }
+    });
+    measure("버퍼 모아 쓰기    ", [&] {
+        BulkWriter writer(filename);
+        for (const auto& line : lines) writer.writeLine(line);
+        writer.close();
+    });
+    measure("+ fdatasync       ", [&] {
+        WritePolicy policy;
+        policy.syncData = true;
+        BulkWriter writer(filename, policy);
+        for (const auto& line : lines) writer.writeLine(line);
+        writer.close();
+    });
+    measure("+ O_DIRECT        ", [&] {
+        WritePolicy policy;
+        policy.directIO = true;
+        policy.syncData = true;
+        BulkWriter writer(filename, policy);
+        if (!writer.isDirect()) cout << "(O_DIRECT 미지원, 일반 쓰기) ";
+        for (const auto& line : lines) writer.writeLine(line);
+        writer.close();
+    });
+}
+
+// 두 파일의 내용이 바이트 단위로 같은지
+bool sameContent(const string& a, const string& b) {
+    MappedFile left(a), right(b);
+    return left.view() == right.view();
+}
+
+// 바이너리 내용과 줄바꿈 없는 끝이 보존되는지: 기존 방식(readFile + writeFile)과 복사 엔진 비교
+void checkBinaryCopy() {
+    {
+        ofstream out("binary.dat", ios::binary);
+        out.write("\x00\x01\r\n\xff\n\n마지막 줄", 21);
+    }
+    streambuf* saved = cout.rdbuf(nullptr);     // 기존 방식의 진행 메시지 숨김
+    FileManager::writeFile("binary_old.dat", FileManager::readFile("binary.dat"));
+    FileCopier::copy("binary.dat", "binary_new.dat");
+    cout.rdbuf(saved);
+    cout << "바이너리 파일 | 기존 방식 " << (sameContent("binary.dat", "binary_old.dat") ? "일치" : "불일치")
+         << " | 복사 엔진 " << (sameContent("binary.dat", "binary_new.dat") ? "일치" : "불일치") << endl;
+    for (const char* name : {"binary.dat", "binary_old.dat", "binary_new.dat"}) filesystem::remove(name);
+}
+
+// 복사 비교: 기존 방식(readFile + writeFile) / 바이트 복사 엔진, 그리고 디렉토리 트리 병렬 복사
+void benchmarkCopyFile(const string& filename, size_t megabytes) {
+    generateLogFile(filename, megabytes);
+    double size = static_cast<double>(filesystem::file_size(filename)) / (1 << 20);
+    auto measure = [&](const char* name, auto&& copyAll) {
+        auto start = chrono::steady_clock::now();
+        copyAll();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << name << " | " << size / seconds << " MB/s" << endl;
+    };
+
+    measure("readFile + writeFile", [&] {
+        streambuf* original = cout.rdbuf(nullptr);
+        FileManager::writeFile(filename + ".old", FileManager::readFile(filename));
+        cout.rdbuf(original);
+    });
+    int reports = 0;
+    measure("복사 엔진           ", [&] {
+        FileCopier::copy(filename, filename + ".new", [&](uint64_t, uint64_t) { reports++; });
+    });
+    cout << "복사본 일치: " << (sameContent(filename, filename + ".new") ? "예" : "아니오")
+         << " (진행 보고 " << reports << "회)" << endl;
+    filesystem::remove(filename + ".old");
+    filesystem::remove(filename + ".new");
+
+    // 디렉토리 트리: 하위 디렉토리 8개 x 32KB 파일 16개 (모두 4MB)
+    const string treeFile(32 << 10, 'x');
+    filesystem::create_directories("tree_src");
+    for (int d = 0; d < 8; d++) {
+        string dir = "tree_src/dir" + to_string(d);
+        filesystem::create_directories(dir);
+        for (int f = 0; f < 16; f++) {
+            ofstream(dir + "/file" + to_string(f) + ".log", ios::binary) << treeFile;
+        }
+    }
+    double treeSize = static_cast<double>(treeFile.size()) * 8 * 16 / (1 << 20);
+    for (size_t threads : {1, 4}) {
+        auto start = chrono::steady_clock::now();
+        FileCopier::copyTree("tree_src", "tree_dst", threads);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "트리 복사 " << threads << "스레드 | " << treeSize / seconds << " MB/s" << endl;
+        filesystem::remove_all("tree_dst");
+    }
+    filesystem::remove_all("tree_src");
+    filesystem::remove(filename);
+}
+
+// 성능 측정 (수백 MB의 임시 파일을 만들므로 "--bench"를 줄 때만 실행)
+void runBenchmarks() {
+    try {
+        cout << "\n=== 줄 읽기 성능 (256MB, bench_read.log) ===" << endl;
+        benchmarkReadFile("bench_read.log", 256);
+
+        cout << "\n=== 파일 복사 (64MB, bench_copy.log) ===" << endl;
+        benchmarkCopyFile("bench_copy.log", 64);
+
+        cout << "\n=== 병렬 줄 처리 (128MB, bench_pipeline.log) ===" << endl;
+        benchmarkPipeline("bench_pipeline.log", 128);
+
+        cout << "\n=== 대량 쓰기 (1000000줄, bench_write.log) ===" << endl;
+        benchmarkWriteFile("bench_write.log", 1000000);
+    }
+    catch (const exception& e) {
+        cout << "벤치마크 오류: " << e.what() << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
     cout << "=== 파일 I/O 예외 처리 ===" << endl;
 
     // 1. 기본 파일 작업
@@ -193,6 +1282,15 @@ int main() {
         cout << "복사 오류: " << e.what() << endl;
     }
 
+    // 복사본이 원본과 바이트 단위로 같은지
+    try {
+        cout << "복사본 일치: " << (sameContent("test.txt", "backup.txt") ? "예" : "아니오") << endl;
+        FileManager::copyFile("test.txt", "test.txt");     // 자기 자신으로 복사하면 원본이 지워지므로 거부
+    }
+    catch (const exception& e) {
+        cout << "예상된 오류: " << e.what() << endl;
+    }
+
     // 4. RAII 파일 클래스 사용
     cout << "\n=== RAII 파일 클래스 ===" << endl;
     try {
@@ -213,5 +1311,51 @@ int main() {
         cout << "RAII 파일 오류: " << e.what() << endl;
     }
 
+    // 5. 메모리 매핑 읽기
+    cout << "\n=== 메모리 매핑 읽기 ===" << endl;
+    try {
+        MappedFile mapping("test.txt");
+        auto lines = FileManager::readLines(mapping);   // mapping이 살아 있는 동안 유효
+        for (const auto& line : lines) {
+            cout << "  " << line << endl;
+        }
+    }
+    catch (const exception& e) {
+        cout << "매핑 읽기 오류: " << e.what() << endl;
+    }
+
+    // 6. 바이트 복사 엔진
+    cout << "\n=== 바이트 복사 ===" << endl;
+    try {
+        checkBinaryCopy();
+    }
+    catch (const exception& e) {
+        cout << "복사 오류: " << e.what() << endl;
+    }
+
+    // 7. 병렬 줄 처리 (실패한 줄과 청크를 예외로 보고)
+    cout << "\n=== 병렬 줄 처리 ===" << endl;
+    try {
+        FileManager::writeFile("numbers.txt", {"10", "20", "삼십", "40"});
+        PipelineConfig config;
+        config.chunkSize = 4;   // 예시를 위해 줄마다 청크가 나뉘도록
+        LinePipeline::run<long>("numbers.txt",
+            [](long& sum, string_view line) { sum += stol(string(line)); },
+            [](long& total, long&& sum) { total += sum; }, config);
+    }
+    catch (const LineProcessingError& e) {
+        cout << "예상된 오류: " << e.what() << " [내용: " << e.getLine() << "]" << endl;
+    }
+    catch (const exception& e) {
+        cout << "병렬 처리 오류: " << e.what() << endl;
+    }
+    filesystem::remove("numbers.txt");
+
+    if (argc > 1 && string(argv[1]) == "--bench") {
+        runBenchmarks();
+    } else {
+        cout << "\n(성능 측정은 \"--bench\" 인자를 주면 실행됩니다)" << endl;
+    }
+
     return 0;
 }
\ No newline at end of file
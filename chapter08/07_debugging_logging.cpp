@@ -17,10 +17,12 @@
  * - ERROR: 실제 오류 발생 시 중요한 문제 기록
  * 
  * 로깅 전략:
- * - 이중 출력: 콘솔과 파일에 동시 기록
- * - 타임스탬프: 각 로그에 시간 정보 포함
+ * - 다중 싱크: 콘솔, 파일, 메모리 링, 소켓에 동시 기록 (싱크별 레벨 필터)
+ * - 타임스탬프: 각 로그에 시간 정보 포함 (초 단위 캐시, 밀리초까지)
  * - 레벨 필터링: 설정한 레벨 이상만 출력
  * - 버퍼 플러시: 즉시 파일에 기록하여 데이터 손실 방지
+ * - 비동기 모드: 스레드별 큐에 넣고 기록 스레드가 모아서 한 번에 기록
+ * - 지연 포맷팅: 인자를 원시 값으로 저장하고 문자열 변환은 기록 시점에 수행
  * 
  * 사용 시기:
  * - 복잡한 비즈니스 로직의 실행 흐름 추적
@@ -44,7 +46,7 @@
  * - 로그 레벨로 불필요한 메시지 필터링
  * - 파일 I/O 비용 최소화 (버퍼링, 비동기 처리)
  * - 디버그 코드는 릴리즈 빌드에서 제외
- * - 로그 파일 크기 관리 (로테이션, 압축)
+ * - 로그 파일 크기 관리 (로테이션, 압축): setRotation으로 크기/시간 기준 설정
  * 
  * 관련 개념:
  * - 정적 멤버: 클래스 레벨에서 공유되는 로거 인스턴스
@@ -56,7 +58,7 @@
  * - 과도한 로깅은 성능 저하 원인
  * - 민감한 정보(비밀번호 등)는 로그에 기록 금지
  * - 로그 파일 크기 증가로 인한 디스크 공간 관리 필요
- * - 멀티스레드 환경에서는 스레드 안전성 고려
+ * - 멀티스레드 환경에서는 스레드 안전성 고려 (동기 모드는 전역 잠금, 비동기 모드는 스레드별 큐)
  */
 
 #include <iostream>
@@ -65,6 +67,41 @@
 #include <chrono>
 #include <cassert>
 #include <sstream>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <cstdlib>
+#include <cerrno>
+#include <cctype>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #define LOGGER_HAS_TSC 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    #define LOGGER_HAS_UNIX_SOCKET 1
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+    #define LOGGER_HAS_POSIX_SPAWN 1
+    #include <spawn.h>
+    #include <sys/wait.h>
+    extern char** environ;
+#endif
 using namespace std;
 
 enum class LogLevel {
@@ -74,21 +111,1086 @@ enum class LogLevel {
     ERROR
 };
 
+// 비동기 모드에서 큐가 가득 찼을 때의 처리 방식
+enum class OverflowPolicy {
+    DROP,   // 버리고 dropped 카운터 증가 (호출자는 절대 기다리지 않음)
+    BLOCK   // 기록 스레드가 자리를 비울 때까지 대기 (로그 손실 없음)
+};
+
+struct AsyncConfig {
+    size_t queueCapacity = 8192;                        // 스레드별 큐 크기 (레코드 수)
+    chrono::milliseconds flushInterval{50};             // 기록 스레드가 깨어나는 주기
+    OverflowPolicy policy = OverflowPolicy::DROP;
+};
+
+// 지연 포맷팅용 인자 버퍼
+// 인자를 문자열로 바꾸지 않고 (타입 태그 + 원시 바이트)로만 보관한다.
+// 실제 문자열 변환은 기록 스레드나 오프라인 디코더에서 formatMessage로 수행한다.
+// 잘린 문자열 뒤에는 "...", 공간이 없어 저장하지 못한 인자 자리에는 "{?}"가 찍힌다.
+class ArgBuffer {
+public:
+    static constexpr size_t Capacity = 96;
+
+    enum class ArgType : uint8_t { INT64, UINT64, DOUBLE, BOOL, STRING };
+
+private:
+    static constexpr uint16_t TruncatedFlag = 0x8000;  // 문자열 길이 필드의 최상위 비트
+
+    char data[Capacity];
+    uint16_t length = 0;
+
+    void put(ArgType type, const void* bytes, size_t count) {
+        if (length + 1 + count > Capacity) return;  // 공간이 없으면 이후 인자는 "{?}"로 남음
+        data[length++] = static_cast<char>(type);
+        memcpy(data + length, bytes, count);
+        length += static_cast<uint16_t>(count);
+    }
+
+public:
+    template<typename T>
+    void add(const T& value) {
+        if constexpr (is_same<T, bool>::value) {
+            uint8_t raw = value ? 1 : 0;
+            put(ArgType::BOOL, &raw, 1);
+        } else if constexpr (is_integral<T>::value && is_signed<T>::value) {
+            int64_t raw = value;
+            put(ArgType::INT64, &raw, sizeof(raw));
+        } else if constexpr (is_integral<T>::value) {
+            uint64_t raw = value;
+            put(ArgType::UINT64, &raw, sizeof(raw));
+        } else if constexpr (is_floating_point<T>::value) {
+            double raw = value;
+            put(ArgType::DOUBLE, &raw, sizeof(raw));
+        } else {
+            addString(toStringRef(value));
+        }
+    }
+
+    // 긴 문자열은 버퍼 절반(또는 남은 공간)까지만 저장하고 잘렸다고 표시한다
+    // UTF-8 문자 중간에서 끊지 않도록 이어지는 바이트(10xxxxxx) 앞까지 물러난다.
+    void addString(const char* text, size_t count) {
+        size_t header = 1 + sizeof(uint16_t);
+        if (length + header > Capacity) return;
+        size_t size = min({count, Capacity / 2, Capacity - length - header});
+        bool truncated = size < count;
+        if (truncated) {
+            while (size > 0 && (static_cast<unsigned char>(text[size]) & 0xC0) == 0x80) size--;
+        }
+
+        uint16_t field = static_cast<uint16_t>(size) | (truncated ? TruncatedFlag : 0);
+        data[length++] = static_cast<char>(ArgType::STRING);
+        memcpy(data + length, &field, sizeof(field));
+        memcpy(data + length + sizeof(field), text, size);
+        length += static_cast<uint16_t>(sizeof(field) + size);
+    }
+
+    const char* bytes() const { return data; }
+    uint16_t size() const { return length; }
+
+    void assign(const char* bytes, uint16_t count) {
+        length = static_cast<uint16_t>(min<size_t>(count, Capacity));
+        if (length > 0) memcpy(data, bytes, length);
+    }
+
+    // format의 "{}"를 순서대로 인자 값으로 바꾼 문자열
+    string formatMessage(const char* format) const {
+        string result;
+        size_t offset = 0;
+        for (const char* p = format; *p; ++p) {
+            if (p[0] == '{' && p[1] == '}') {
+                if (offset < length) offset = appendArg(result, offset);
+                else result += "{?}";   // 저장되지 못한 인자
+                ++p;
+            } else {
+                result += *p;
+            }
+        }
+        return result;
+    }
+
+private:
+    struct StringRef {
+        const char* text;
+        size_t count;
+    };
+
+    static StringRef toStringRef(const string& value) { return {value.data(), value.size()}; }
+    static StringRef toStringRef(const char* value) { return {value, strlen(value)}; }
+
+    void addString(StringRef ref) { addString(ref.text, ref.count); }
+
+    // 파일에서 읽은 버퍼는 깨져 있을 수 있으므로 모든 읽기를 length 안에서 확인한다
+    // (범위를 벗어나면 "{?}"를 찍고 나머지 인자는 포기)
+    size_t appendArg(string& out, size_t offset) const {
+        ArgType type = static_cast<ArgType>(data[offset++]);
+        auto fits = [&](size_t count) { return offset + count <= length; };
+        switch (type) {
+            case ArgType::INT64: {
+                int64_t value;
+                if (!fits(sizeof(value))) break;
+                memcpy(&value, data + offset, sizeof(value));
+                out += to_string(value);
+                return offset + sizeof(value);
+            }
+            case ArgType::UINT64: {
+                uint64_t value;
+                if (!fits(sizeof(value))) break;
+                memcpy(&value, data + offset, sizeof(value));
+                out += to_string(value);
+                return offset + sizeof(value);
+            }
+            case ArgType::DOUBLE: {
+                double value;
+                if (!fits(sizeof(value))) break;
+                memcpy(&value, data + offset, sizeof(value));
+                out += to_string(value);
+                return offset + sizeof(value);
+            }
+            case ArgType::BOOL:
+                if (!fits(1)) break;
+                out += data[offset] ? "true" : "false";
+                return offset + 1;
+            case ArgType::STRING: {
+                uint16_t field;
+                if (!fits(sizeof(field))) break;
+                memcpy(&field, data + offset, sizeof(field));
+                offset += sizeof(field);
+                size_t count = field & ~TruncatedFlag;
+                if (!fits(count)) break;
+                out.append(data + offset, count);
+                if (field & TruncatedFlag) out += "...";
+                return offset + count;
+            }
+        }
+        out += "{?}";
+        return length;
+    }
+};
+
+// 기록 스레드로 넘기는 로그 한 줄
+// format이 있으면 args로 나중에 포맷팅하고, 없으면 이미 완성된 message를 사용한다.
+struct LogRecord {
+    LogLevel level;
+    uint64_t sequence = 0;          // 전역 순번 (스레드별 큐를 합칠 때 정렬 기준)
+    chrono::system_clock::time_point time;
+    string message;
+    const char* format = nullptr;   // 문자열 리터럴 (정적 수명)
+    ArgBuffer args;
+};
+
+// 바이너리 로그 파일 형식 (오프라인 디코더용)
+// 레코드: 레벨(1) | 시각 us(8) | 포맷 길이(2) + 포맷 | 인자 길이(2) + 인자 바이트
+// 포맷이 없는 레코드는 message를 포맷 자리에 그대로 넣고 인자 길이를 0으로 둔다.
+class BinaryLogCodec {
+public:
+    static void write(ostream& out, const LogRecord& record) {
+        uint8_t level = static_cast<uint8_t>(record.level);
+        int64_t micros = chrono::duration_cast<chrono::microseconds>(record.time.time_since_epoch()).count();
+        const char* text = record.format ? record.format : record.message.c_str();
+        uint16_t textLength = static_cast<uint16_t>(min<size_t>(strlen(text), UINT16_MAX));
+        uint16_t argsLength = record.format ? record.args.size() : 0;
+
+        out.write(reinterpret_cast<const char*>(&level), sizeof(level));
+        out.write(reinterpret_cast<const char*>(&micros), sizeof(micros));
+        out.write(reinterpret_cast<const char*>(&textLength), sizeof(textLength));
+        out.write(text, textLength);
+        out.write(reinterpret_cast<const char*>(&argsLength), sizeof(argsLength));
+        out.write(record.args.bytes(), argsLength);
+    }
+
+    // 한 레코드를 읽어 포맷팅된 문자열로 복원. 파일 끝이면 false
+    static bool readFormatted(istream& in, LogLevel& level, chrono::system_clock::time_point& time, string& message) {
+        uint8_t rawLevel;
+        int64_t micros;
+        uint16_t textLength, argsLength;
+        if (!in.read(reinterpret_cast<char*>(&rawLevel), sizeof(rawLevel))) return false;
+        in.read(reinterpret_cast<char*>(&micros), sizeof(micros));
+        in.read(reinterpret_cast<char*>(&textLength), sizeof(textLength));
+        string format(textLength, '\0');
+        in.read(&format[0], textLength);
+        in.read(reinterpret_cast<char*>(&argsLength), sizeof(argsLength));
+        vector<char> argBytes(argsLength);
+        in.read(argBytes.data(), argsLength);
+        if (!in) throw runtime_error("바이너리 로그가 손상되었습니다.");
+
+        ArgBuffer args;
+        args.assign(argBytes.data(), argsLength);
+        level = static_cast<LogLevel>(rawLevel);
+        time = chrono::system_clock::time_point(chrono::microseconds(micros));
+        message = argsLength > 0 ? args.formatMessage(format.c_str()) : format;
+        return true;
+    }
+};
+
+// 스레드별 단일 생산자/단일 소비자 링 버퍼 (잠금 없음)
+// 생산자는 로그를 남기는 스레드 하나, 소비자는 기록 스레드 하나다.
+class ThreadLogQueue {
+private:
+    vector<LogRecord> slots;
+    size_t mask;
+    atomic<size_t> head{0};     // 생산자가 다음에 쓸 위치
+    atomic<size_t> tail{0};     // 소비자가 다음에 읽을 위치
+    atomic<bool> orphaned{false};   // 생산자 스레드가 종료됨
+    atomic<uint64_t> reserved{UINT64_MAX};  // 생산자가 잡으려는 순번의 하한 (없으면 최댓값)
+
+public:
+    explicit ThreadLogQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    bool tryPush(LogRecord&& record) {
+        size_t h = head.load(memory_order_relaxed);
+        if (h - tail.load(memory_order_acquire) > mask) return false;  // 가득 참
+        slots[h & mask] = std::move(record);
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+
+    // 순번을 잡기 전에 하한을 공개하고, 넣은 뒤(또는 버린 뒤) 해제한다
+    // 기록 스레드는 공개된 하한보다 작은 순번까지만 내보낸다.
+    void reserve(uint64_t lowerBound) { reserved.store(lowerBound); }
+    void release() { reserved.store(UINT64_MAX); }
+    uint64_t reservedSequence() const { return reserved.load(); }
+
+    // 생산자 스레드가 끝날 때 호출. 이후 한 번 더 비우면 등록을 해제해도 된다
+    void markOrphaned() { orphaned.store(true, memory_order_release); }
+    bool isOrphaned() const { return orphaned.load(memory_order_acquire); }
+
+    // 쌓인 레코드를 모두 fn에 넘기고 처리한 개수 반환
+    template<typename Fn>
+    size_t drain(Fn&& fn) {
+        size_t t = tail.load(memory_order_relaxed);
+        size_t h = head.load(memory_order_acquire);
+        for (size_t i = t; i != h; ++i) {
+            fn(slots[i & mask]);
+        }
+        tail.store(h, memory_order_release);
+        return h - t;
+    }
+};
+
+// 로그 파일 로테이션 정책 (0이면 해당 조건 사용 안 함)
+struct RotationPolicy {
+    size_t maxBytes = 0;                        // 파일 크기 기준
+    chrono::seconds interval{0};                // 시간 기준
+    size_t maxSegments = 5;                     // 보관할 이전 파일 수 (초과분은 삭제)
+    bool compress = false;                      // 이전 파일을 백그라운드에서 압축
+    string compressCommand = "gzip -f";         // 압축 명령 (공백으로 나눈 단어 + 파일 경로로 실행, 셸 해석 없음)
+    string compressSuffix = ".gz";
+};
+
+// 백그라운드 압축 작업자
+// 로테이션된 파일 경로를 받아 별도 스레드에서 외부 압축 명령을 실행한다.
+// 보관 한도 초과 파일 삭제도 같은 큐로 처리해 압축과 삭제 순서가 뒤바뀌지 않게 한다.
+class BackgroundCompressor {
+private:
+    struct Job {
+        string path;
+        bool remove;    // true면 압축 대신 삭제
+    };
+
+    thread worker;
+    mutex jobsMutex;
+    condition_variable jobsReady;
+    deque<Job> jobs;
+    vector<string> commandArgs;     // 압축 명령을 단어로 나눈 것 (마지막에 파일 경로를 붙임)
+    bool stopping = false;
+    void push(Job job) {
+        {
+            lock_guard<mutex> lock(jobsMutex);
+            jobs.push_back(move(job));
+        }
+        jobsReady.notify_one();
+    }
+
+    void run() {
+        while (true) {
+            Job job;
+            {
+                unique_lock<mutex> lock(jobsMutex);
+                jobsReady.wait(lock, [&] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) return;   // stopping이고 남은 작업 없음
+                job = move(jobs.front());
+                jobs.pop_front();
+            }
+            if (job.remove) {
+                error_code ec;
+                filesystem::remove(job.path, ec);
+                continue;
+            }
+            if (!runCommand(job.path)) {
+                cerr << "로그 압축 실패: " << job.path << endl;
+            }
+        }
+    }
+
+    // 셸을 거치지 않고 실행하므로 경로에 따옴표나 $, ` 가 있어도 명령으로 해석되지 않는다
+    bool runCommand(const string& path) {
+        if (commandArgs.empty()) return false;
+#ifdef LOGGER_HAS_POSIX_SPAWN
+        vector<char*> argv;
+        for (auto& arg : commandArgs) argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(const_cast<char*>(path.c_str()));
+        argv.push_back(nullptr);
+
+        pid_t pid;
+        if (posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) != 0) return false;
+        int status = 0;
+        while (waitpid(pid, &status, 0) < 0) {
+            if (errno != EINTR) return false;
+        }
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#else
+        // spawn이 없는 환경은 system()을 쓰되, 셸이 해석할 수 있는 문자가 든 경로는 거부
+        if (path.find_first_of("\"%!^&|<>`$") != string::npos) return false;
+        string line;
+        for (const auto& arg : commandArgs) line += arg + " ";
+        line += "\"" + path + "\"";
+        return system(line.c_str()) == 0;
+#endif
+    }
+
+public:
+    void start(const string& compressCommand) {
+        if (worker.joinable()) return;
+        commandArgs.clear();
+        istringstream words(compressCommand);
+        for (string word; words >> word;) commandArgs.push_back(word);
+        stopping = false;
+        worker = thread(&BackgroundCompressor::run, this);
+    }
+
+    void submit(const string& path) {
+        push(Job{path, false});
+    }
+
+    void submitRemove(const string& path) {
+        push(Job{path, true});
+    }
+
+
+    // 남은 작업을 모두 끝낸 뒤 종료
+    void stop() {
+        if (!worker.joinable()) return;
+        {
+            lock_guard<mutex> lock(jobsMutex);
+            stopping = true;
+        }
+        jobsReady.notify_one();
+        worker.join();
+    }
+};
+
+// 로그 출력 대상 (싱크)
+// Logger는 기록 스레드(비동기 모드)나 sinksMutex 안(동기 모드)에서만 write/flush를 호출한다.
+// 싱크마다 최소 레벨을 따로 둘 수 있다 (전역 레벨보다 낮은 로그는 애초에 만들어지지 않음).
+class LogSink {
+private:
+    atomic<LogLevel> minLevel{LogLevel::DEBUG};
+
+public:
+    virtual ~LogSink() = default;
+
+    void setLevel(LogLevel level) { minLevel.store(level, memory_order_relaxed); }
+    bool accepts(LogLevel level) const { return level >= minLevel.load(memory_order_relaxed); }
+
+    // line은 포맷팅이 끝난 한 줄 (줄바꿈 포함). needsText가 false면 빈 문자열
+    virtual void write(const LogRecord& record, const string& line) = 0;
+
+    // 텍스트 줄이 필요 없는 싱크(원시 레코드만 쓰는 경우)는 false: 포맷팅 비용을 건너뜀
+    virtual bool needsText() const { return true; }
+
+    // 배치(동기 모드는 한 줄)가 끝날 때마다 호출
+    virtual void flush() {}
+};
+
+// 콘솔 싱크: 배치를 모아 한 번에 출력
+class ConsoleSink : public LogSink {
+private:
+    string pending;
+
+public:
+    void write(const LogRecord&, const string& line) override { pending += line; }
+
+    void flush() override {
+        if (pending.empty()) return;
+        cout.write(pending.data(), pending.size());
+        cout.flush();
+        pending.clear();
+    }
+};
+
+// 파일 싱크 (크기/시간 기준 로테이션 + 백그라운드 압축)
+class FileSink : public LogSink {
+private:
+    mutex fileMutex;        // 기록과 로테이션 설정/수동 로테이션 사이 보호
+    ofstream file;
+    string filename;
+    RotationPolicy policy;
+    size_t currentBytes = 0;
+    chrono::steady_clock::time_point segmentStart;
+    uint64_t segmentCounter = 0;
+    deque<string> segments;
+    BackgroundCompressor compressor;
+    string pending;         // 배치 동안 모은 줄
+
+    // 정책에 걸리면 로테이션한다
+    // 배치는 여러 줄이므로 크기 한도에 맞춰 줄 경계에서 나눠 쓴다.
+    void writeLocked(const char* data, size_t size) {
+        if (policy.interval.count() > 0 &&
+            chrono::steady_clock::now() - segmentStart >= policy.interval) {
+            rotateLocked();
+        }
+
+        while (policy.maxBytes > 0 && currentBytes + size > policy.maxBytes) {
+            // 남은 공간에 들어가는 마지막 줄 끝까지 쓰고 로테이션
+            size_t room = policy.maxBytes > currentBytes ? policy.maxBytes - currentBytes : 0;
+            size_t cut = 0;
+            for (size_t i = min(room, size); i > 0; i--) {
+                if (data[i - 1] == '\n') { cut = i; break; }
+            }
+            if (cut == 0 && currentBytes == 0) {
+                // 한 줄이 한도보다 긴 경우: 그 줄은 통째로 기록
+                const char* end = static_cast<const char*>(memchr(data, '\n', size));
+                cut = end ? static_cast<size_t>(end - data) + 1 : size;
+            }
+            if (cut > 0) {
+                file.write(data, cut);
+                currentBytes += cut;
+                data += cut;
+                size -= cut;
+            }
+            if (size == 0) break;
+            rotateLocked();
+        }
+
+        file.write(data, size);
+        file.flush();
+        currentBytes += size;
+    }
+
+    // 디스크에 남아 있는 "이름.순번"(압축본 포함)을 찾아 순번을 이어 붙이고 보관 목록에 넣는다
+    // (다시 시작해도 이전 파일을 덮어쓰지 않고, 보관 한도 계산에도 포함되도록)
+    void adoptExistingSegments() {
+        filesystem::path base(filename);
+        filesystem::path dir = base.parent_path().empty() ? filesystem::path(".") : base.parent_path();
+        string prefix = base.filename().string() + ".";
+
+        vector<pair<uint64_t, string>> found;
+        error_code ec;
+        for (filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            string name = it->path().filename().string();
+            if (name.compare(0, prefix.size(), prefix) != 0) continue;
+            size_t digitsEnd = prefix.size();
+            while (digitsEnd < name.size() && isdigit(static_cast<unsigned char>(name[digitsEnd]))) digitsEnd++;
+            size_t digits = digitsEnd - prefix.size();
+            if (digits == 0 || digits > 18) continue;
+            string rest = name.substr(digitsEnd);
+            if (!rest.empty() && rest != policy.compressSuffix) continue;
+            found.emplace_back(stoull(name.substr(prefix.size(), digits)), filename + name.substr(prefix.size() - 1));
+        }
+        sort(found.begin(), found.end());
+
+        segments.clear();
+        for (auto& [number, path] : found) {
+            segmentCounter = max(segmentCounter, number);
+            segments.push_back(move(path));
+        }
+    }
+
+    // 현재 파일을 "이름.순번"으로 바꾸고 새 파일을 연다
+    void rotateLocked() {
+        file.close();
+
+        string rotated = filename + "." + to_string(++segmentCounter);
+        error_code ec;
+        filesystem::rename(filename, rotated, ec);
+        if (ec) {
+            cerr << "로그 로테이션 실패: " << ec.message() << endl;
+        } else if (policy.compress) {
+            compressor.submit(rotated);
+            segments.push_back(rotated + policy.compressSuffix);
+        } else {
+            segments.push_back(rotated);
+        }
+
+        // 보관 개수를 넘는 오래된 파일 삭제 (압축 중이면 압축이 끝난 뒤 삭제)
+        while (segments.size() > policy.maxSegments) {
+            if (policy.compress) {
+                compressor.submitRemove(segments.front());
+            } else {
+                filesystem::remove(segments.front(), ec);
+            }
+            segments.pop_front();
+        }
+
+        file.open(filename, ios::app);
+        currentBytes = 0;
+        segmentStart = chrono::steady_clock::now();
+    }
+
+public:
+    explicit FileSink(const string& name, const RotationPolicy& rotation = RotationPolicy())
+        : filename(name) {
+        file.open(filename, ios::app);
+        error_code ec;
+        auto size = filesystem::file_size(filename, ec);
+        currentBytes = ec ? 0 : static_cast<size_t>(size);
+        setRotation(rotation);
+        adoptExistingSegments();
+    }
+
+    ~FileSink() override { close(); }
+
+    void setRotation(const RotationPolicy& rotation) {
+        lock_guard<mutex> lock(fileMutex);
+        policy = rotation;
+        segmentStart = chrono::steady_clock::now();
+        if (policy.compress) compressor.start(policy.compressCommand);
+    }
+
+    // 현재 파일을 즉시 로테이션
+    void rotate() {
+        lock_guard<mutex> lock(fileMutex);
+        if (file.is_open()) rotateLocked();
+    }
+
+    // 마지막으로 만든 이전 파일의 순번 (디스크에 있던 것 포함)
+    uint64_t getRotationCount() {
+        lock_guard<mutex> lock(fileMutex);
+        return segmentCounter;
+    }
+
+    void write(const LogRecord&, const string& line) override { pending += line; }
+
+    void flush() override {
+        if (pending.empty()) return;
+        lock_guard<mutex> lock(fileMutex);
+        if (file.is_open()) writeLocked(pending.data(), pending.size());
+        pending.clear();
+    }
+
+    // 파일을 닫고 대기 중인 압축을 마친다
+    void close() {
+        {
+            lock_guard<mutex> lock(fileMutex);
+            if (file.is_open()) file.close();
+        }
+        compressor.stop();
+    }
+};
+
+// 바이너리 레코드 싱크 (BinaryLogCodec 형식, decodeBinaryLog로 해독)
+class BinaryFileSink : public LogSink {
+private:
+    ofstream file;
+
+public:
+    explicit BinaryFileSink(const string& filename) {
+        file.open(filename, ios::binary | ios::trunc);
+    }
+
+    void write(const LogRecord& record, const string&) override { BinaryLogCodec::write(file, record); }
+    bool needsText() const override { return false; }
+    void flush() override { file.flush(); }
+};
+
+// 메모리 링 싱크: 최근 N줄만 보관했다가 크래시 덤프 등에 출력
+// dump는 아무 스레드에서나 부를 수 있어 자체 잠금을 둔다.
+class MemoryRingSink : public LogSink {
+private:
+    mutable mutex ringMutex;
+    vector<string> lines;
+    size_t next = 0;
+    size_t count = 0;
+
+public:
+    explicit MemoryRingSink(size_t capacity) : lines(max<size_t>(capacity, 1)) {}
+
+    void write(const LogRecord&, const string& line) override {
+        lock_guard<mutex> lock(ringMutex);
+        lines[next].assign(line);       // 기존 버퍼 재사용
+        next = (next + 1) % lines.size();
+        count = min(count + 1, lines.size());
+    }
+
+    // 오래된 줄부터 출력
+    void dump(ostream& out) const {
+        lock_guard<mutex> lock(ringMutex);
+        size_t start = (next + lines.size() - count) % lines.size();
+        for (size_t i = 0; i < count; i++) {
+            out << lines[(start + i) % lines.size()];
+        }
+    }
+
+    size_t size() const {
+        lock_guard<mutex> lock(ringMutex);
+        return count;
+    }
+};
+
+#ifdef LOGGER_HAS_UNIX_SOCKET
+// 데이터그램 싱크: 유닉스 도메인 소켓으로 전송 (원격 수집기 대용)
+// 여러 줄을 MaxDatagram 이하로 묶어 보내고, 수신 측이 밀리면 기다리지 않고 버린다.
+class DatagramSink : public LogSink {
+public:
+    static constexpr size_t MaxDatagram = 4096;
+
+private:
+    int socketFd = -1;
+    sockaddr_un target{};
+    string pending;
+    atomic<uint64_t> droppedLines{0};
+    size_t pendingLines = 0;
+
+    void send() {
+        if (pending.empty()) return;
+        ssize_t sent = sendto(socketFd, pending.data(), pending.size(), MSG_DONTWAIT,
+                              reinterpret_cast<const sockaddr*>(&target), sizeof(target));
+        if (sent < 0) droppedLines += pendingLines;
+        pending.clear();
+        pendingLines = 0;
+    }
+
+public:
+    explicit DatagramSink(const string& path) {
+        if (path.size() >= sizeof(target.sun_path)) {
+            throw runtime_error("소켓 경로가 너무 깁니다: " + path);
+        }
+        socketFd = socket(AF_UNIX, SOCK_DGRAM, 0);
+        if (socketFd < 0) throw runtime_error("로그 소켓을 만들 수 없습니다.");
+        target.sun_family = AF_UNIX;
+        memcpy(target.sun_path, path.c_str(), path.size() + 1);
+    }
+
+    ~DatagramSink() override {
+        if (socketFd >= 0) ::close(socketFd);
+    }
+
+    DatagramSink(const DatagramSink&) = delete;
+    DatagramSink& operator=(const DatagramSink&) = delete;
+
+    void write(const LogRecord&, const string& line) override {
+        if (pending.size() + line.size() > MaxDatagram) send();
+        pending += line;
+        pendingLines++;
+    }
+
+    void flush() override { send(); }
+
+    uint64_t getDroppedCount() const { return droppedLines.load(); }
+};
+#endif
+
+// 타임스탬프 정밀도
+enum class TimestampPrecision {
+    SECONDS,        // [HH:MM:SS]
+    MILLISECONDS,   // [HH:MM:SS.mmm]
+    MICROSECONDS    // [HH:MM:SS.uuuuuu]
+};
+
+// 초 단위 캐시를 쓰는 타임스탬프 생성기
+// localtime 변환은 초가 바뀔 때만 하고, 밀리/마이크로초는 정수 연산으로
+// 고정 크기 char 버퍼에 직접 써넣는다 (힙 할당 없음). 스레드마다 캐시를 따로 둔다.
+class TimestampCache {
+public:
+    static constexpr size_t BufferSize = 24;
+
+private:
+    time_t cachedSecond = -1;
+    char secondPrefix[16];      // "[HH:MM:SS"
+    size_t prefixLength = 0;
+
+    static void writeTwoDigits(char* out, int value) {
+        out[0] = static_cast<char>('0' + value / 10);
+        out[1] = static_cast<char>('0' + value % 10);
+    }
+
+    void refresh(time_t second) {
+        tm local;
+#if defined(_WIN32)
+        localtime_s(&local, &second);
+#else
+        localtime_r(&second, &local);
+#endif
+        secondPrefix[0] = '[';
+        writeTwoDigits(secondPrefix + 1, local.tm_hour);
+        secondPrefix[3] = ':';
+        writeTwoDigits(secondPrefix + 4, local.tm_min);
+        secondPrefix[6] = ':';
+        writeTwoDigits(secondPrefix + 7, local.tm_sec);
+        prefixLength = 9;
+        cachedSecond = second;
+    }
+
+public:
+    // out에 타임스탬프를 쓰고 길이 반환 (out은 BufferSize 이상)
+    size_t format(chrono::system_clock::time_point time, TimestampPrecision precision, char* out) {
+        auto micros = chrono::duration_cast<chrono::microseconds>(time.time_since_epoch()).count();
+        time_t second = static_cast<time_t>(micros / 1000000);
+        long fraction = static_cast<long>(micros % 1000000);
+        if (fraction < 0) {         // 1970년 이전 (음수) 보정
+            fraction += 1000000;
+            --second;
+        }
+        if (second != cachedSecond) refresh(second);
+
+        memcpy(out, secondPrefix, prefixLength);
+        size_t length = prefixLength;
+
+        int digits = precision == TimestampPrecision::MICROSECONDS ? 6
+                   : precision == TimestampPrecision::MILLISECONDS ? 3 : 0;
+        if (digits > 0) {
+            long value = digits == 3 ? fraction / 1000 : fraction;
+            out[length++] = '.';
+            for (int i = digits - 1; i >= 0; --i) {
+                out[length + i] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+            length += digits;
+        }
+        out[length++] = ']';
+        return length;
+    }
+};
+
+// TSC(타임스탬프 카운터) 기반 단조 시계
+// 시작 시 벽시계와 함께 TSC를 읽어 두 번 보정하고, 이후에는 rdtsc 한 번으로 시각을 계산한다.
+// TSC가 없는 플랫폼에서는 system_clock을 그대로 사용한다.
+class TscClock {
+private:
+    uint64_t baseTicks = 0;
+    chrono::system_clock::time_point baseTime;
+    double nanosPerTick = 0;
+
+    static uint64_t readTicks() {
+#ifdef LOGGER_HAS_TSC
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+public:
+    static bool isSupported() {
+#ifdef LOGGER_HAS_TSC
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // calibration 동안 벽시계와 TSC의 진행 비율을 측정
+    void calibrate(chrono::milliseconds calibration = chrono::milliseconds(20)) {
+        if (!isSupported()) return;
+        auto steadyStart = chrono::steady_clock::now();
+        uint64_t ticksStart = readTicks();
+        this_thread::sleep_for(calibration);
+        auto steadyEnd = chrono::steady_clock::now();
+        uint64_t ticksEnd = readTicks();
+
+        double nanos = chrono::duration<double, nano>(steadyEnd - steadyStart).count();
+        nanosPerTick = nanos / static_cast<double>(ticksEnd - ticksStart);
+        baseTicks = readTicks();
+        baseTime = chrono::system_clock::now();
+    }
+
+    bool isCalibrated() const { return nanosPerTick > 0; }
+
+    chrono::system_clock::time_point now() const {
+        if (!isCalibrated()) return chrono::system_clock::now();
+        double elapsed = static_cast<double>(readTicks() - baseTicks) * nanosPerTick;
+        return baseTime + chrono::duration_cast<chrono::system_clock::duration>(
+            chrono::nanoseconds(static_cast<int64_t>(elapsed)));
+    }
+};
+
 class Logger {
 private:
-    static ofstream logFile;
+    // 출력 싱크 (목록 변경과 동기 모드 기록은 sinksMutex 안에서만)
+    static mutex sinksMutex;
+    static vector<shared_ptr<LogSink>> sinks;
+    static shared_ptr<ConsoleSink> consoleSink;
+    static shared_ptr<FileSink> fileSink;
+    static shared_ptr<BinaryFileSink> binarySink;
+    static RotationPolicy rotationPolicy;   // 다음 initialize로 여는 파일에도 적용
+
     static LogLevel currentLevel;
+    static atomic<uint64_t> nextSequence;   // 전역 순번 (싱크 출력 순서 기준)
+    static uint64_t currentWatermark;       // 기록 스레드 전용: 이번에 내보낼 수 있는 순번 상한 (미만)
 
-    static string getCurrentTime() {
-        auto now = chrono::system_clock::now();
-        auto time_t = chrono::system_clock::to_time_t(now);
-        auto tm = *localtime(&time_t);
+    // 비동기 모드 상태
+    static atomic<bool> asyncMode;
+    static AsyncConfig asyncConfig;
+    static thread writerThread;
+    static atomic<bool> stopWriter;
+    static mutex writerMutex;
+    static condition_variable writerWake;
+    static mutex queuesMutex;
+    static vector<shared_ptr<ThreadLogQueue>> queues;
+    static atomic<uint64_t> droppedCount;
 
-        stringstream ss;
-        ss << "[" << tm.tm_hour << ":" << tm.tm_min << ":" << tm.tm_sec << "]";
-        return ss.str();
+    // 타임스탬프
+    static TimestampPrecision timestampPrecision;
+    static TscClock tscClock;
+    static bool useTscClock;
+
+    static chrono::system_clock::time_point now() {
+        return useTscClock ? tscClock.now() : chrono::system_clock::now();
+    }
+
+    static void appendRecord(string& out, const LogRecord& record) {
+        char buffer[TimestampCache::BufferSize];
+        out.append(buffer, formatTimestamp(record.time, buffer));
+        out += " [";
+        out += levelToString(record.level);
+        out += "] ";
+        if (record.format) out += record.args.formatMessage(record.format);
+        else out += record.message;
     }
 
+    static void attachLocked(const shared_ptr<LogSink>& sink) {
+        if (find(sinks.begin(), sinks.end(), sink) == sinks.end()) sinks.push_back(sink);
+    }
+
+    static void detachLocked(const shared_ptr<LogSink>& sink) {
+        sinks.erase(remove(sinks.begin(), sinks.end(), sink), sinks.end());
+    }
+
+    // 텍스트가 필요한 싱크가 받을 때만 한 번 포맷팅해서 나눠 준다 (sinksMutex 안에서 호출)
+    static void dispatchLocked(const LogRecord& record, string& line) {
+        static const string noText;
+        bool formatted = false;
+        for (auto& sink : sinks) {
+            if (!sink->accepts(record.level)) continue;
+            if (!sink->needsText()) {
+                sink->write(record, noText);
+                continue;
+            }
+            if (!formatted) {
+                line.clear();
+                appendRecord(line, record);
+                line += '\n';
+                formatted = true;
+            }
+            sink->write(record, line);
+        }
+    }
+
+    static void flushLocked() {
+        for (auto& sink : sinks) sink->flush();
+    }
+
+    // 현재 스레드 전용 큐 (처음 호출할 때 만들어 기록 스레드에 등록)
+    // 스레드가 끝나면 표시만 해 두고, 기록 스레드가 마지막으로 비운 뒤 목록에서 뺀다.
+    struct LocalQueue {
+        shared_ptr<ThreadLogQueue> queue;
+        ~LocalQueue() { if (queue) queue->markOrphaned(); }
+    };
+
+    static ThreadLogQueue& localQueue() {
+        thread_local LocalQueue local;
+        if (!local.queue) {
+            local.queue = make_shared<ThreadLogQueue>(asyncConfig.queueCapacity);
+            lock_guard<mutex> lock(queuesMutex);
+            queues.push_back(local.queue);
+        }
+        return *local.queue;
+    }
+
+    // 모든 스레드 큐를 비우고 전역 순번 순서로 싱크에 넘긴 레코드 수를 반환
+    // 워터마크(아직 큐에 들어오지 않았을 수 있는 가장 작은 순번) 이상인 레코드는 held에 남겨
+    // 다음 호출로 미루므로, 배치가 달라도 순번이 뒤바뀌지 않는다. 각 싱크는 호출마다 한 번 flush.
+    static size_t drainQueues(vector<LogRecord>& held, vector<LogRecord*>& order, string& line) {
+        {
+            lock_guard<mutex> lock(queuesMutex);
+            // 워터마크를 먼저 구하고 나서 비워야 그보다 작은 순번은 모두 이번에 손에 들어온다
+            uint64_t watermark = nextSequence.load();
+            for (auto& queue : queues) watermark = min(watermark, queue->reservedSequence());
+            currentWatermark = watermark;
+
+            for (auto& queue : queues) {
+                bool orphaned = queue->isOrphaned();    // 비우기 전에 확인해야 마지막 로그를 놓치지 않음
+                queue->drain([&](LogRecord& record) { held.push_back(std::move(record)); });
+                if (orphaned) queue.reset();
+            }
+            queues.erase(remove(queues.begin(), queues.end(), nullptr), queues.end());
+        }
+
+        order.clear();
+        for (auto& record : held) {
+            if (record.sequence < currentWatermark) order.push_back(&record);
+        }
+        if (order.empty()) return 0;
+        sort(order.begin(), order.end(),
+             [](const LogRecord* a, const LogRecord* b) { return a->sequence < b->sequence; });
+
+        {
+            lock_guard<mutex> lock(sinksMutex);
+            for (const LogRecord* record : order) dispatchLocked(*record, line);
+            flushLocked();
+        }
+
+        size_t emitted = order.size();
+        held.erase(remove_if(held.begin(), held.end(),
+                             [](const LogRecord& record) { return record.sequence < currentWatermark; }),
+                   held.end());
+        return emitted;
+    }
+
+    static void writerLoop() {
+        vector<LogRecord> held;
+        vector<LogRecord*> order;
+        string line;
+        while (!stopWriter.load()) {
+            {
+                unique_lock<mutex> lock(writerMutex);
+                writerWake.wait_for(lock, asyncConfig.flushInterval);
+            }
+            drainQueues(held, order, line);
+        }
+        // 종료 전 남은 로그 모두 기록 (이때는 로그를 남기는 스레드가 없어 워터마크가 끝까지 올라감)
+        while (drainQueues(held, order, line) > 0 || !held.empty()) {}
+    }
+
+    // 동기 모드: 전역 잠금으로 줄 단위 직렬화 (여러 스레드가 써도 줄이 섞이지 않음)
+    static void writeSync(const LogRecord& record) {
+        thread_local string line;
+        lock_guard<mutex> lock(sinksMutex);
+        dispatchLocked(record, line);
+        flushLocked();
+    }
+
+    static void submit(LogRecord&& record) {
+        if (!asyncMode) {
+            record.sequence = nextSequence.fetch_add(1);
+            writeSync(record);
+            return;
+        }
+
+        ThreadLogQueue& queue = localQueue();   // 등록을 먼저 (순번을 잡은 채로 queuesMutex를 기다리지 않게)
+        queue.reserve(nextSequence.load());     // 이 하한 이상인 순번은 기록 스레드가 내보내지 않고 기다림
+        record.sequence = nextSequence.fetch_add(1);
+        while (!queue.tryPush(std::move(record))) {
+            if (asyncConfig.policy == OverflowPolicy::DROP) {
+                droppedCount.fetch_add(1, memory_order_relaxed);
+                break;
+            }
+            writerWake.notify_one();    // BLOCK: 기록 스레드를 깨우고 자리가 날 때까지 대기
+            this_thread::yield();
+        }
+        queue.release();
+    }
+
+public:
+    // 파일 싱크를 (다시) 연다. 콘솔 싱크는 setConsoleOutput으로 켜고 끈다
+    static void initialize(const string& filename, LogLevel level = LogLevel::INFO) {
+        {
+            lock_guard<mutex> lock(sinksMutex);
+            if (fileSink) {
+                detachLocked(fileSink);
+                fileSink->close();
+            }
+            fileSink = make_shared<FileSink>(filename, rotationPolicy);
+            attachLocked(fileSink);
+        }
+        currentLevel = level;
+        log(LogLevel::INFO, "로그 시스템 초기화");
+    }
+
+    // 비동기 모드: 호출자는 자기 스레드 큐에 넣기만 하고, 기록 스레드가 모아서 기록
+    // (켜고 끄는 것은 다른 스레드가 로그를 남기지 않을 때 메인 스레드에서)
+    static void enableAsync(const AsyncConfig& config = AsyncConfig()) {
+        if (asyncMode) return;
+        asyncConfig = config;
+        stopWriter = false;
+        asyncMode = true;
+        writerThread = thread(writerLoop);
+    }
+
+    // 큐를 모두 비운 뒤 동기 모드로 복귀
+    static void disableAsync() {
+        if (!asyncMode) return;
+        stopWriter = true;
+        writerWake.notify_one();
+        writerThread.join();
+        asyncMode = false;
+    }
+
+    static bool isAsync() { return asyncMode; }
+    static uint64_t getDroppedCount() { return droppedCount.load(); }
+
+    // 싱크 추가/제거 (아무 때나 가능, 다음 배치부터 반영)
+    static void addSink(const shared_ptr<LogSink>& sink) {
+        lock_guard<mutex> lock(sinksMutex);
+        attachLocked(sink);
+    }
+
+    static void removeSink(const shared_ptr<LogSink>& sink) {
+        lock_guard<mutex> lock(sinksMutex);
+        detachLocked(sink);
+    }
+
+    static void setConsoleOutput(bool enabled) {
+        if (enabled) addSink(consoleSink);
+        else removeSink(consoleSink);
+    }
+
+    static void setConsoleLevel(LogLevel level) { consoleSink->setLevel(level); }
+
+    static void setFileLevel(LogLevel level) {
+        lock_guard<mutex> lock(sinksMutex);
+        if (fileSink) fileSink->setLevel(level);
+    }
+
+    // 바이너리 레코드 파일 (BinaryLogCodec 형식, decodeBinaryLog로 해독)
+    static void enableBinaryOutput(const string& filename) {
+        lock_guard<mutex> lock(sinksMutex);
+        if (binarySink) detachLocked(binarySink);
+        binarySink = make_shared<BinaryFileSink>(filename);
+        attachLocked(binarySink);
+    }
+
+    static bool isEnabled(LogLevel level) { return level >= currentLevel; }
+
+    // 크기/시간 기준 로테이션 (initialize 전후 아무 때나 설정 가능)
+    static void setRotation(const RotationPolicy& policy) {
+        lock_guard<mutex> lock(sinksMutex);
+        rotationPolicy = policy;
+        if (fileSink) fileSink->setRotation(policy);
+    }
+
+    // 현재 파일을 즉시 로테이션
+    static void rotate() {
+        lock_guard<mutex> lock(sinksMutex);
+        if (fileSink) fileSink->rotate();
+    }
+
+    static uint64_t getRotationCount() {
+        lock_guard<mutex> lock(sinksMutex);
+        return fileSink ? fileSink->getRotationCount() : 0;
+    }
+
+    static void setTimestampPrecision(TimestampPrecision precision) { timestampPrecision = precision; }
+
+    // TSC 시계 사용 (벽시계로 보정 후 사용, 지원하지 않으면 system_clock 유지)
+    static void enableTscClock() {
+        if (!TscClock::isSupported()) return;
+        tscClock.calibrate();
+        useTscClock = true;
+    }
+
+    // 호출한 스레드의 캐시로 out에 타임스탬프를 쓰고 길이 반환
+    static size_t formatTimestamp(chrono::system_clock::time_point time, char* out) {
+        thread_local TimestampCache cache;
+        return cache.format(time, timestampPrecision, out);
+    }
+
+    static size_t formatCurrentTimestamp(char* out) { return formatTimestamp(now(), out); }
+
     static string levelToString(LogLevel level) {
         switch (level) {
             case LogLevel::DEBUG: return "DEBUG";
@@ -99,48 +1201,116 @@ private:
         }
     }
 
-public:
-    static void initialize(const string& filename, LogLevel level = LogLevel::INFO) {
-        logFile.open(filename, ios::app);
-        currentLevel = level;
-        log(LogLevel::INFO, "로그 시스템 초기화");
+    static void log(LogLevel level, const string& message) {
+        if (level < currentLevel) return;
+
+        LogRecord record;
+        record.level = level;
+        record.time = now();
+        record.message = message;
+        submit(std::move(record));
     }
 
-    static void log(LogLevel level, const string& message) {
+    // 구조화 로깅: 인자는 원시 값으로만 저장 (문자열 변환은 기록 시점으로 미뤄짐)
+    // 비동기 모드에서는 format 포인터만 넘기므로 문자열 리터럴이어야 한다.
+    // 직접 부르지 말고 LOG_* 매크로를 쓸 것: 리터럴인지와 {} 개수를 컴파일 시점에 검사한다.
+    template<size_t N, typename... Args>
+    static void logFormat(LogLevel level, const char (&format)[N], const Args&... args) {
         if (level < currentLevel) return;
 
-        string logMessage = getCurrentTime() + " [" + levelToString(level) + "] " + message;
+        LogRecord record;
+        record.level = level;
+        record.time = now();
+        record.format = format;
+        (record.args.add(args), ...);
+        submit(std::move(record));
+    }
 
-        cout << logMessage << endl;  // 콘솔 출력
-        if (logFile.is_open()) {
-            logFile << logMessage << endl;  // 파일 출력
-            logFile.flush();
+    // 포맷의 "{}" 개수 (formatMessage와 같은 규칙)
+    static constexpr size_t countPlaceholders(const char* format) {
+        size_t count = 0;
+        for (const char* p = format; *p; ++p) {
+            if (p[0] == '{' && p[1] == '}') {
+                ++count;
+                ++p;
+            }
         }
+        return count;
     }
 
+    // 포맷 뒤 인자 개수 (decltype 안에서만 사용, 정의 없음)
+    template<size_t N, typename... Args>
+    static integral_constant<size_t, sizeof...(Args)> formatArity(const char (&format)[N], const Args&... args);
+
     static void debug(const string& message) { log(LogLevel::DEBUG, message); }
     static void info(const string& message) { log(LogLevel::INFO, message); }
     static void warning(const string& message) { log(LogLevel::WARNING, message); }
     static void error(const string& message) { log(LogLevel::ERROR, message); }
 
+    // 비동기 모드라면 큐에 남은 로그를 모두 기록한 뒤 파일을 닫는다
+    // (콘솔과 addSink로 붙인 싱크는 그대로 유지)
     static void close() {
         log(LogLevel::INFO, "로그 시스템 종료");
-        if (logFile.is_open()) {
-            logFile.close();
+        disableAsync();
+        lock_guard<mutex> lock(sinksMutex);
+        if (fileSink) {
+            detachLocked(fileSink);
+            fileSink->close();      // 대기 중인 압축까지 마침 (로테이션 횟수 조회용으로 객체는 유지)
+        }
+        if (binarySink) {
+            detachLocked(binarySink);
+            binarySink.reset();
         }
     }
 };
 
 // 정적 멤버 초기화
-ofstream Logger::logFile;
+mutex Logger::sinksMutex;
+shared_ptr<ConsoleSink> Logger::consoleSink = make_shared<ConsoleSink>();
+vector<shared_ptr<LogSink>> Logger::sinks{Logger::consoleSink};
+shared_ptr<FileSink> Logger::fileSink;
+shared_ptr<BinaryFileSink> Logger::binarySink;
+RotationPolicy Logger::rotationPolicy;
 LogLevel Logger::currentLevel = LogLevel::INFO;
+atomic<uint64_t> Logger::nextSequence{0};
+uint64_t Logger::currentWatermark = 0;
+atomic<bool> Logger::asyncMode{false};
+AsyncConfig Logger::asyncConfig;
+thread Logger::writerThread;
+atomic<bool> Logger::stopWriter{false};
+mutex Logger::writerMutex;
+condition_variable Logger::writerWake;
+mutex Logger::queuesMutex;
+vector<shared_ptr<ThreadLogQueue>> Logger::queues;
+atomic<uint64_t> Logger::droppedCount{0};
+TimestampPrecision Logger::timestampPrecision = TimestampPrecision::MILLISECONDS;
+TscClock Logger::tscClock;
+bool Logger::useTscClock = false;
 
-// 디버깅용 매크로
+// 구조화 로깅 매크로: 레벨이 꺼져 있으면 인자 식 자체를 평가하지 않음
+// 첫 인자는 문자열 리터럴만 허용하고 ("" 포맷 "" 연결), {} 개수와 인자 개수가 다르면 컴파일 오류
+#define LOG_EXPAND(x) x
+#define LOG_FORMAT_OF_(format, ...) "" format ""
+#define LOG_FORMAT_OF(...) LOG_EXPAND(LOG_FORMAT_OF_(__VA_ARGS__, _))
+#define LOG_CHECK_FORMAT(...) \
+    static_assert(Logger::countPlaceholders(LOG_FORMAT_OF(__VA_ARGS__)) == \
+                  decltype(Logger::formatArity(__VA_ARGS__))::value, \
+                  "로그 포맷의 {} 개수와 인자 개수가 다릅니다")
+#define LOG_AT(level, ...) \
+    do { \
+        LOG_CHECK_FORMAT(__VA_ARGS__); \
+        if (Logger::isEnabled(level)) Logger::logFormat(level, __VA_ARGS__); \
+    } while (0)
+#define LOG_INFO(...) LOG_AT(LogLevel::INFO, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_AT(LogLevel::WARNING, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LogLevel::ERROR, __VA_ARGS__)
+
+// 디버깅용 매크로 (릴리즈 빌드에서는 인자까지 통째로 사라짐)
 #ifdef _DEBUG
-    #define DEBUG_LOG(msg) Logger::debug(msg)
+    #define DEBUG_LOG(...) LOG_AT(LogLevel::DEBUG, __VA_ARGS__)
     #define ASSERT_MSG(condition, msg) assert((condition) && (msg))
 #else
-    #define DEBUG_LOG(msg)
+    #define DEBUG_LOG(...) do { LOG_CHECK_FORMAT(__VA_ARGS__); } while (0)     // 검사만, 평가는 안 함
     #define ASSERT_MSG(condition, msg)
 #endif
 
@@ -154,15 +1324,15 @@ public:
     }
 
     double add(double a, double b) {
-        DEBUG_LOG("덧셈 연산: " + to_string(a) + " + " + to_string(b));
+        DEBUG_LOG("덧셈 연산: {} + {}", a, b);
 
         lastResult = a + b;
-        Logger::info("덧셈 완료: " + to_string(lastResult));
+        LOG_INFO("덧셈 완료: {}", lastResult);
         return lastResult;
     }
 
     double divide(double a, double b) {
-        DEBUG_LOG("나눗셈 연산: " + to_string(a) + " / " + to_string(b));
+        DEBUG_LOG("나눗셈 연산: {} / {}", a, b);
 
         if (b == 0) {
             Logger::error("0으로 나누기 시도!");
@@ -173,12 +1343,12 @@ public:
         ASSERT_MSG(b != 0, "나누는 수가 0이 아니어야 합니다");
 
         lastResult = a / b;
-        Logger::info("나눗셈 완료: " + to_string(lastResult));
+        LOG_INFO("나눗셈 완료: {}", lastResult);
         return lastResult;
     }
 
     double getLastResult() const {
-        DEBUG_LOG("마지막 결과 조회: " + to_string(lastResult));
+        DEBUG_LOG("마지막 결과 조회: {}", lastResult);
         return lastResult;
     }
 
@@ -187,8 +1357,257 @@ public:
     }
 };
 
-int main() {
-    // 로그 시스템 초기화
+// 오프라인 디코더: 바이너리 레코드를 읽어 텍스트 로그로 출력
+void decodeBinaryLog(const string& filename) {
+    ifstream in(filename, ios::binary);
+    if (!in.is_open()) {
+        cout << "바이너리 로그를 열 수 없습니다: " << filename << endl;
+        return;
+    }
+
+    LogLevel level;
+    chrono::system_clock::time_point time;
+    string message;
+    while (BinaryLogCodec::readFormatted(in, level, time, message)) {
+        cout << "  [" << Logger::levelToString(level) << "] " << message << endl;
+    }
+}
+
+// 로그 접두어(타임스탬프) 생성 비용: 기존 stringstream 방식과 캐시 방식 비교
+void benchmarkTimestamp(int iterations) {
+    char buffer[TimestampCache::BufferSize];
+    size_t checksum = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        auto time_t = chrono::system_clock::to_time_t(chrono::system_clock::now());
+        auto tm = *localtime(&time_t);
+        stringstream ss;
+        ss << "[" << tm.tm_hour << ":" << tm.tm_min << ":" << tm.tm_sec << "]";
+        checksum += ss.str().size();
+    }
+    auto legacy = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        checksum += Logger::formatTimestamp(chrono::system_clock::now(), buffer);
+    }
+    auto cached = chrono::steady_clock::now();
+    Logger::enableTscClock();
+    auto tscStart = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        checksum += Logger::formatCurrentTimestamp(buffer);
+    }
+    auto tscEnd = chrono::steady_clock::now();
+
+    auto nsPer = [&](chrono::steady_clock::duration d) {
+        return chrono::duration<double, nano>(d).count() / iterations;
+    };
+    cout << "stringstream: " << nsPer(legacy - start) << "ns"
+         << " | 캐시: " << nsPer(cached - legacy) << "ns"
+         << " | 캐시+TSC: " << nsPer(tscEnd - tscStart) << "ns"
+         << " (예: " << string(buffer, Logger::formatCurrentTimestamp(buffer)) << ", 검사값 " << checksum << ")" << endl;
+}
+
+// 동기/비동기 로깅 성능 비교 (콘솔 출력은 끄고 파일에만 기록)
+void benchmarkLogger(bool async, int lines) {
+    Logger::setConsoleOutput(false);
+    Logger::initialize("bench.log", LogLevel::INFO);
+    if (async) {
+        AsyncConfig config;
+        config.policy = OverflowPolicy::BLOCK;  // 비교를 위해 로그 손실 없이
+        Logger::enableAsync(config);
+    }
+
+    vector<double> latencies;
+    latencies.reserve(lines);
+    string message = "벤치마크 로그 메시지 - 고정 길이 본문";
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < lines; i++) {
+        auto before = chrono::steady_clock::now();
+        Logger::info(message);
+        latencies.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - before).count());
+    }
+    auto callerDone = chrono::steady_clock::now();
+    Logger::close();    // 비동기 모드는 여기서 남은 로그를 모두 기록
+    auto allDone = chrono::steady_clock::now();
+    Logger::setConsoleOutput(true);
+    filesystem::remove("bench.log");
+
+    sort(latencies.begin(), latencies.end());
+    double callerSeconds = chrono::duration<double>(callerDone - start).count();
+    double totalSeconds = chrono::duration<double>(allDone - start).count();
+
+    cout << (async ? "비동기" : "동기  ")
+         << " | p50 " << latencies[lines / 2] << "us"
+         << " | p99 " << latencies[lines * 99 / 100] << "us"
+         << " | 호출자 " << static_cast<long>(lines / callerSeconds) << "줄/초"
+         << " | 전체 " << static_cast<long>(lines / totalSeconds) << "줄/초"
+         << " | 버림 " << Logger::getDroppedCount() << endl;
+}
+
+// 로테이션 부하 검사: 여러 스레드가 쓰는 동안 로테이션이 일어나도 줄이 빠지거나 겹치지 않는지 확인
+void rotationStressTest(int threadCount, int linesPerThread, size_t maxBytes) {
+    const string filename = "rotate.log";
+    filesystem::remove(filename);
+
+    RotationPolicy policy;
+    policy.maxBytes = maxBytes;
+    policy.maxSegments = 100000;    // 검사를 위해 모든 파일 보관 (압축 없음)
+    Logger::setRotation(policy);
+
+    Logger::setConsoleOutput(false);
+    Logger::initialize(filename, LogLevel::INFO);
+    AsyncConfig config;
+    config.policy = OverflowPolicy::BLOCK;
+    Logger::enableAsync(config);
+
+    uint64_t firstSegment = Logger::getRotationCount() + 1;
+    vector<thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([t, linesPerThread] {
+            for (int i = 0; i < linesPerThread; i++) {
+                LOG_INFO("stress {} {}", t, i);
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    Logger::close();
+    Logger::setConsoleOutput(true);
+    uint64_t lastSegment = Logger::getRotationCount();
+    Logger::setRotation(RotationPolicy{});
+
+    // 이전 파일 + 현재 파일을 모두 읽어 (스레드, 순번)별 등장 횟수 집계
+    vector<string> files;
+    for (uint64_t n = firstSegment; n <= lastSegment; n++) files.push_back(filename + "." + to_string(n));
+    files.push_back(filename);
+
+    vector<uint8_t> seen(static_cast<size_t>(threadCount) * linesPerThread, 0);
+    size_t duplicates = 0;
+    for (const auto& file : files) {
+        ifstream in(file);
+        string line;
+        while (getline(in, line)) {
+            auto pos = line.find("stress ");
+            if (pos == string::npos) continue;
+            int t = 0, i = 0;
+            istringstream(line.substr(pos + 7)) >> t >> i;
+            if (seen[static_cast<size_t>(t) * linesPerThread + i]++) duplicates++;
+        }
+        in.close();
+        filesystem::remove(file);
+    }
+    size_t missing = static_cast<size_t>(count(seen.begin(), seen.end(), 0));
+
+    cout << threadCount << "스레드 x " << linesPerThread << "줄"
+         << " | 로테이션 " << (lastSegment - firstSegment + 1) << "회"
+         << " | 누락 " << missing << " | 중복 " << duplicates
+         << (missing == 0 && duplicates == 0 ? " (정상)" : " (오류)") << endl;
+}
+
+// 싱크별 레벨 필터: 콘솔은 WARNING 이상, 메모리 링은 전부, 소켓은 ERROR만
+void sinkDemo() {
+    auto ring = make_shared<MemoryRingSink>(4);
+    Logger::addSink(ring);
+#ifdef LOGGER_HAS_UNIX_SOCKET
+    // 원격 수집기 대용 수신 소켓
+    const string socketPath = "log_collector.sock";
+    unlink(socketPath.c_str());
+    int receiver = socket(AF_UNIX, SOCK_DGRAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    bind(receiver, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+
+    auto datagram = make_shared<DatagramSink>(socketPath);
+    datagram->setLevel(LogLevel::ERROR);
+    Logger::addSink(datagram);
+#endif
+
+    Logger::setConsoleLevel(LogLevel::WARNING);
+    Logger::initialize("sinks.log", LogLevel::DEBUG);
+    for (int i = 0; i < 5; i++) {
+        LOG_INFO("작업 {} 완료", i);
+    }
+    Logger::warning("디스크 사용량 90%");
+    Logger::error("데이터베이스 연결 끊김");
+    Logger::close();
+    Logger::setConsoleLevel(LogLevel::DEBUG);
+    Logger::removeSink(ring);
+
+    cout << "메모리 링 (최근 " << ring->size() << "줄):" << endl;
+    ring->dump(cout);
+
+#ifdef LOGGER_HAS_UNIX_SOCKET
+    Logger::removeSink(datagram);
+    char buffer[DatagramSink::MaxDatagram];
+    ssize_t received;
+    while ((received = recv(receiver, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+        cout << "소켓 수신: " << string(buffer, static_cast<size_t>(received));
+    }
+    close(receiver);
+    unlink(socketPath.c_str());
+#endif
+    filesystem::remove("sinks.log");
+}
+
+// 스레드 수에 따른 처리량: 동기(전역 잠금) vs 비동기(스레드별 큐 + 기록 스레드)
+void benchmarkThreadScaling(int linesPerThread) {
+    for (int threadCount : {1, 2, 4, 8, 16, 32}) {
+        double linesPerSecond[2];
+        for (int async = 0; async < 2; async++) {
+            Logger::setConsoleOutput(false);
+            Logger::initialize("scale.log", LogLevel::INFO);
+            if (async) {
+                AsyncConfig config;
+                config.policy = OverflowPolicy::BLOCK;
+                Logger::enableAsync(config);
+            }
+
+            auto start = chrono::steady_clock::now();
+            vector<thread> workers;
+            for (int t = 0; t < threadCount; t++) {
+                workers.emplace_back([t, linesPerThread] {
+                    for (int i = 0; i < linesPerThread; i++) {
+                        LOG_INFO("스레드 {} 메시지 {}", t, i);
+                    }
+                });
+            }
+            for (auto& worker : workers) worker.join();
+            Logger::close();    // 남은 로그까지 기록해야 끝난 것으로 본다
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            Logger::setConsoleOutput(true);
+            filesystem::remove("scale.log");
+
+            linesPerSecond[async] = threadCount * static_cast<double>(linesPerThread) / seconds;
+        }
+        cout << threadCount << "스레드"
+             << " | 동기 " << static_cast<long>(linesPerSecond[0]) << "줄/초"
+             << " | 비동기 " << static_cast<long>(linesPerSecond[1]) << "줄/초" << endl;
+    }
+}
+
+// 성능 측정과 부하 검사 ("--bench"를 줄 때만 실행, 만든 로그 파일은 각자 지운다)
+void runBenchmarks() {
+    cout << "\n=== 동기 vs 비동기 로깅 (20000줄, bench.log) ===" << endl;
+    benchmarkLogger(false, 20000);
+    benchmarkLogger(true, 20000);
+
+    cout << "\n=== 로그 접두어 생성 (1000000회, 1회당 ns) ===" << endl;
+    benchmarkTimestamp(1000000);
+
+    cout << "\n=== 로그 로테이션 부하 검사 (rotate.log) ===" << endl;
+    rotationStressTest(16, 2000, 10 * 1024);
+
+    cout << "\n=== 다중 싱크 (sinks.log, 메모리 링, 소켓) ===" << endl;
+    sinkDemo();
+
+    cout << "\n=== 스레드 수별 처리량 (스레드당 20000줄, scale.log) ===" << endl;
+    benchmarkThreadScaling(20000);
+}
+
+int main(int argc, char* argv[]) {
+    // 로그 시스템 초기화 (텍스트 + 바이너리 레코드)
+    Logger::enableBinaryOutput("app.bin");
     Logger::initialize("app.log", LogLevel::DEBUG);
 
     cout << "=== 디버깅과 로깅 시스템 ===" << endl;
@@ -199,10 +1618,10 @@ int main() {
         Logger::info("프로그램 시작");
 
         double result1 = calc.add(10, 5);
-        Logger::info("첫 번째 계산 결과: " + to_string(result1));
+        LOG_INFO("첫 번째 계산 결과: {}", result1);
 
         double result2 = calc.divide(20, 4);
-        Logger::info("두 번째 계산 결과: " + to_string(result2));
+        LOG_INFO("두 번째 계산 결과: {}", result2);
 
         // 경고 상황
         Logger::warning("0으로 나누기를 시도합니다.");
@@ -224,5 +1643,15 @@ int main() {
 
     cout << "\n로그가 'app.log' 파일에 저장되었습니다." << endl;
 
+    // 바이너리 레코드는 인자를 원시 값으로 저장했다가 여기서 포맷팅
+    cout << "\n=== 바이너리 로그 해독 (app.bin) ===" << endl;
+    decodeBinaryLog("app.bin");
+
+    if (argc > 1 && string(argv[1]) == "--bench") {
+        runBenchmarks();
+    } else {
+        cout << "\n(성능 측정은 \"--bench\" 인자를 주면 실행됩니다)" << endl;
+    }
+
     return 0;
 }
\ No newline at end of file
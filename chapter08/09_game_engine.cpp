@@ -19,11 +19,51 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
+#include <unordered_map>
 #include <algorithm>
 #include <stdexcept>
 #include <chrono>
 #include <random>
 #include <functional>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <new>
+#include <type_traits>
+#include <tuple>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <exception>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define GAME_ENGINE_POSIX 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #define GAME_ENGINE_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+// GCC/Clang은 함수 단위로 AVX2 코드 생성을 허용 (MSVC는 플래그 없이 intrinsic 사용 가능)
+#if defined(GAME_ENGINE_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define GAME_ENGINE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define GAME_ENGINE_TARGET_AVX2
+#endif
 
 namespace GameEngine {
 
@@ -35,6 +75,19 @@ namespace GameEngine {
         GAME_OVER
     };
 
+    // 게임 객체 종류 태그 (SoA 저장소의 타입별 배치 처리용)
+    enum class ObjectType {
+        PLAYER,
+        ENEMY,
+        ITEM
+    };
+
+    // 엔티티 저장 방식
+    enum class StorageMode {
+        OBJECTS,    // unique_ptr<GameObject> 배열 (기본)
+        SOA         // 구조체 배열 대신 필드별 연속 배열
+    };
+
     // 2D 벡터 클래스
     struct Vector2D {
         float x, y;
@@ -68,8 +121,258 @@ namespace GameEngine {
                 y /= magnitude;
             }
         }
+
+        // this에서 target까지 t(0~1)만큼 보간
+        Vector2D lerp(const Vector2D& target, float t) const {
+            return Vector2D(x + (target.x - x) * t, y + (target.y - y) * t);
+        }
+    };
+
+    // SIMD 명령어 수준
+    enum class SimdLevel {
+        SCALAR,
+        SSE2,
+        AVX2
     };
 
+    // Vector2D 배치 연산 커널
+    // x, y를 분리된 배열(SoA)로 받아 전체 개체군을 한 번에 처리한다.
+    // 실행 시점에 CPU를 검사해 AVX2 -> SSE2 -> 스칼라 순으로 경로를 고른다.
+    // sqrt와 나눗셈은 IEEE 정확 반올림이므로 모든 경로의 결과가 스칼라와 같다.
+    namespace VectorBatch {
+
+        inline SimdLevel detectSimdLevel() {
+#if defined(GAME_ENGINE_X86) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+            if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#elif defined(GAME_ENGINE_X86) && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            int maxLeaf = info[0];
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool sse2 = (info[3] & (1 << 26)) != 0;
+            if (maxLeaf >= 7 && osxsave && (_xgetbv(0) & 0x6) == 0x6) {
+                __cpuidex(info, 7, 0);
+                if (info[1] & (1 << 5)) return SimdLevel::AVX2;
+            }
+            if (sse2) return SimdLevel::SSE2;
+#endif
+            return SimdLevel::SCALAR;
+        }
+
+        // 현재 사용 중인 수준 (벤치마크나 검증을 위해 낮출 수 있음)
+        inline SimdLevel& activeLevel() {
+            static SimdLevel level = detectSimdLevel();
+            return level;
+        }
+
+        inline const char* levelName(SimdLevel level) {
+            switch (level) {
+                case SimdLevel::AVX2: return "AVX2";
+                case SimdLevel::SSE2: return "SSE2";
+                default: return "SCALAR";
+            }
+        }
+
+        // ----- 스칼라 경로 (start부터 count까지) -----
+        inline void integrateScalar(float* px, float* py, const float* vx, const float* vy,
+                                    size_t start, size_t count, float deltaTime) {
+            for (size_t i = start; i < count; ++i) {
+                px[i] += vx[i] * deltaTime;
+                py[i] += vy[i] * deltaTime;
+            }
+        }
+
+        inline void normalizeScalar(float* x, float* y, size_t start, size_t count) {
+            for (size_t i = start; i < count; ++i) {
+                float magnitude = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+                if (magnitude > 0) {
+                    x[i] /= magnitude;
+                    y[i] /= magnitude;
+                }
+            }
+        }
+
+        inline void distanceSquaredScalar(const float* px, const float* py, size_t start, size_t count,
+                                          float tx, float ty, float* out) {
+            for (size_t i = start; i < count; ++i) {
+                float dx = px[i] - tx;
+                float dy = py[i] - ty;
+                out[i] = dx * dx + dy * dy;
+            }
+        }
+
+        inline void clampScalar(float* px, float* py, size_t start, size_t count,
+                                float width, float height) {
+            for (size_t i = start; i < count; ++i) {
+                px[i] = std::min(std::max(px[i], 0.0f), width);
+                py[i] = std::min(std::max(py[i], 0.0f), height);
+            }
+        }
+
+#if defined(GAME_ENGINE_X86)
+        // ----- SSE2 경로 (4개씩) -----
+        inline size_t integrateSSE2(float* px, float* py, const float* vx, const float* vy,
+                                    size_t count, float deltaTime) {
+            const __m128 dt = _mm_set1_ps(deltaTime);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt)));
+                _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt)));
+            }
+            return i;
+        }
+
+        inline size_t normalizeSSE2(float* x, float* y, size_t count) {
+            const __m128 zero = _mm_setzero_ps();
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 vx = _mm_loadu_ps(x + i);
+                __m128 vy = _mm_loadu_ps(y + i);
+                __m128 mag = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+                __m128 mask = _mm_cmpgt_ps(mag, zero);
+                __m128 nx = _mm_div_ps(vx, mag);
+                __m128 ny = _mm_div_ps(vy, mag);
+                _mm_storeu_ps(x + i, _mm_or_ps(_mm_and_ps(mask, nx), _mm_andnot_ps(mask, vx)));
+                _mm_storeu_ps(y + i, _mm_or_ps(_mm_and_ps(mask, ny), _mm_andnot_ps(mask, vy)));
+            }
+            return i;
+        }
+
+        inline size_t distanceSquaredSSE2(const float* px, const float* py, size_t count,
+                                          float tx, float ty, float* out) {
+            const __m128 targetX = _mm_set1_ps(tx);
+            const __m128 targetY = _mm_set1_ps(ty);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 dx = _mm_sub_ps(_mm_loadu_ps(px + i), targetX);
+                __m128 dy = _mm_sub_ps(_mm_loadu_ps(py + i), targetY);
+                _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+            }
+            return i;
+        }
+
+        inline size_t clampSSE2(float* px, float* py, size_t count, float width, float height) {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 maxX = _mm_set1_ps(width);
+            const __m128 maxY = _mm_set1_ps(height);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                _mm_storeu_ps(px + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(px + i), zero), maxX));
+                _mm_storeu_ps(py + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(py + i), zero), maxY));
+            }
+            return i;
+        }
+
+        // ----- AVX2 경로 (8개씩) -----
+        GAME_ENGINE_TARGET_AVX2
+        inline size_t integrateAVX2(float* px, float* py, const float* vx, const float* vy,
+                                    size_t count, float deltaTime) {
+            const __m256 dt = _mm256_set1_ps(deltaTime);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                _mm256_storeu_ps(px + i, _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), dt)));
+                _mm256_storeu_ps(py + i, _mm256_add_ps(_mm256_loadu_ps(py + i), _mm256_mul_ps(_mm256_loadu_ps(vy + i), dt)));
+            }
+            return i;
+        }
+
+        GAME_ENGINE_TARGET_AVX2
+        inline size_t normalizeAVX2(float* x, float* y, size_t count) {
+            const __m256 zero = _mm256_setzero_ps();
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 vx = _mm256_loadu_ps(x + i);
+                __m256 vy = _mm256_loadu_ps(y + i);
+                __m256 mag = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)));
+                __m256 mask = _mm256_cmp_ps(mag, zero, _CMP_GT_OQ);
+                _mm256_storeu_ps(x + i, _mm256_blendv_ps(vx, _mm256_div_ps(vx, mag), mask));
+                _mm256_storeu_ps(y + i, _mm256_blendv_ps(vy, _mm256_div_ps(vy, mag), mask));
+            }
+            return i;
+        }
+
+        GAME_ENGINE_TARGET_AVX2
+        inline size_t distanceSquaredAVX2(const float* px, const float* py, size_t count,
+                                          float tx, float ty, float* out) {
+            const __m256 targetX = _mm256_set1_ps(tx);
+            const __m256 targetY = _mm256_set1_ps(ty);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(px + i), targetX);
+                __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(py + i), targetY);
+                _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+            }
+            return i;
+        }
+
+        GAME_ENGINE_TARGET_AVX2
+        inline size_t clampAVX2(float* px, float* py, size_t count, float width, float height) {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 maxX = _mm256_set1_ps(width);
+            const __m256 maxY = _mm256_set1_ps(height);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                _mm256_storeu_ps(px + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(px + i), zero), maxX));
+                _mm256_storeu_ps(py + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(py + i), zero), maxY));
+            }
+            return i;
+        }
+#endif
+
+        // ----- 공개 API: 선택된 경로로 처리하고 남은 부분은 스칼라로 마무리 -----
+
+        // position += velocity * deltaTime
+        inline void integrate(float* px, float* py, const float* vx, const float* vy,
+                              size_t count, float deltaTime, SimdLevel level = activeLevel()) {
+            size_t done = 0;
+#if defined(GAME_ENGINE_X86)
+            if (level == SimdLevel::AVX2) done = integrateAVX2(px, py, vx, vy, count, deltaTime);
+            else if (level == SimdLevel::SSE2) done = integrateSSE2(px, py, vx, vy, count, deltaTime);
+#endif
+            (void)level;
+            integrateScalar(px, py, vx, vy, done, count, deltaTime);
+        }
+
+        // 모든 벡터를 단위 벡터로 (길이 0인 벡터는 그대로)
+        inline void normalizeAll(float* x, float* y, size_t count, SimdLevel level = activeLevel()) {
+            size_t done = 0;
+#if defined(GAME_ENGINE_X86)
+            if (level == SimdLevel::AVX2) done = normalizeAVX2(x, y, count);
+            else if (level == SimdLevel::SSE2) done = normalizeSSE2(x, y, count);
+#endif
+            (void)level;
+            normalizeScalar(x, y, done, count);
+        }
+
+        // 각 위치와 target 사이 거리의 제곱 (sqrt 없이 반경 비교용)
+        inline void distanceSquared(const float* px, const float* py, size_t count,
+                                    const Vector2D& target, float* out, SimdLevel level = activeLevel()) {
+            size_t done = 0;
+#if defined(GAME_ENGINE_X86)
+            if (level == SimdLevel::AVX2) done = distanceSquaredAVX2(px, py, count, target.x, target.y, out);
+            else if (level == SimdLevel::SSE2) done = distanceSquaredSSE2(px, py, count, target.x, target.y, out);
+#endif
+            (void)level;
+            distanceSquaredScalar(px, py, done, count, target.x, target.y, out);
+        }
+
+        // [0, width] x [0, height] 범위로 제한
+        inline void clampToBounds(float* px, float* py, size_t count,
+                                  float width, float height, SimdLevel level = activeLevel()) {
+            size_t done = 0;
+#if defined(GAME_ENGINE_X86)
+            if (level == SimdLevel::AVX2) done = clampAVX2(px, py, count, width, height);
+            else if (level == SimdLevel::SSE2) done = clampSSE2(px, py, count, width, height);
+#endif
+            (void)level;
+            clampScalar(px, py, done, count, width, height);
+        }
+
+    } // namespace VectorBatch
+
     // 게임 예외 클래스들
     class GameException : public std::exception {
     protected:
@@ -91,32 +394,516 @@ namespace GameEngine {
             : GameException("게임 오브젝트를 찾을 수 없음: " + name) {}
     };
 
-    // 이벤트 시스템
+    // 고정 크기 MPSC(다중 생산자, 단일 소비자) 링 버퍼
+    // 칸마다 순번(sequence)을 두는 잠금 없는 방식이다. 가득 차면 push가 실패한다.
     template<typename T>
+    class MpscRingBuffer {
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        std::unique_ptr<Cell[]> cells;
+        size_t mask;
+        alignas(64) std::atomic<size_t> enqueuePos;
+        alignas(64) size_t dequeuePos;    // 소비자 전용
+
+    public:
+        // capacity는 2의 거듭제곱으로 올림
+        explicit MpscRingBuffer(size_t capacity) : enqueuePos(0), dequeuePos(0) {
+            size_t size = 2;
+            while (size < capacity) size <<= 1;
+            cells.reset(new Cell[size]);
+            mask = size - 1;
+            for (size_t i = 0; i < size; ++i) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        size_t capacity() const { return mask + 1; }
+
+        bool tryPush(const T& item) {
+            size_t pos = enqueuePos.load(std::memory_order_relaxed);
+            while (true) {
+                Cell& cell = cells[pos & mask];
+                size_t seq = cell.sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.value = item;
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;    // 가득 참
+                } else {
+                    pos = enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool tryPop(T& item) {
+            Cell& cell = cells[dequeuePos & mask];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(dequeuePos + 1) < 0) {
+                return false;    // 비어 있음
+            }
+            item = std::move(cell.value);
+            cell.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+            ++dequeuePos;
+            return true;
+        }
+    };
+
+    // 작은 버퍼 함수 객체 (small-buffer delegate)
+    // 호출 가능 객체를 내부 버퍼에 그대로 보관한다. (std::function 하나가 들어가는 크기)
+    // 버퍼에 안 들어가면 생성(리스너 등록) 시점에 한 번만 힙에 할당하고, 호출과 이동은 할당 없이 처리한다.
+    template<typename Signature, size_t Capacity = 64>
+    class Delegate;
+
+    template<typename R, typename... Args, size_t Capacity>
+    class Delegate<R(Args...), Capacity> {
+    private:
+        alignas(std::max_align_t) unsigned char storage[Capacity];
+        R (*invoker)(void*, Args...);
+        void (*mover)(void* dst, void* src);    // dst가 nullptr이면 소멸만
+
+        template<typename F>
+        static R invokeImpl(void* object, Args... args) {
+            return (*static_cast<F*>(object))(std::forward<Args>(args)...);
+        }
+
+        template<typename F>
+        static void moveImpl(void* dst, void* src) {
+            F* source = static_cast<F*>(src);
+            if (dst) new (dst) F(std::move(*source));
+            source->~F();
+        }
+
+        // 힙 보관: 버퍼에는 포인터만 둔다
+        template<typename F>
+        static R invokeHeap(void* object, Args... args) {
+            return (**static_cast<F**>(object))(std::forward<Args>(args)...);
+        }
+
+        template<typename F>
+        static void moveHeap(void* dst, void* src) {
+            F* target = *static_cast<F**>(src);
+            if (dst) new (dst) F*(target);
+            else delete target;
+        }
+
+        template<typename F>
+        static constexpr bool fitsInline = sizeof(F) <= Capacity &&
+                                           alignof(F) <= alignof(std::max_align_t) &&
+                                           std::is_nothrow_move_constructible<F>::value;
+
+        void reset() {
+            if (mover) mover(nullptr, storage);
+            invoker = nullptr;
+            mover = nullptr;
+        }
+
+    public:
+        Delegate() : invoker(nullptr), mover(nullptr) {}
+        Delegate(std::nullptr_t) : Delegate() {}
+
+        template<typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, Delegate>::value>>
+        Delegate(F&& f) : Delegate() {
+            using Functor = std::decay_t<F>;
+            static_assert(sizeof(Functor*) <= Capacity, "Delegate: 버퍼가 포인터보다 작습니다");
+            if constexpr (fitsInline<Functor>) {
+                new (storage) Functor(std::forward<F>(f));
+                invoker = &invokeImpl<Functor>;
+                mover = &moveImpl<Functor>;
+            } else {
+                new (storage) Functor*(new Functor(std::forward<F>(f)));
+                invoker = &invokeHeap<Functor>;
+                mover = &moveHeap<Functor>;
+            }
+        }
+
+        // 내부 버퍼에 들어가는지 (false면 생성 시 힙 할당)
+        template<typename F>
+        static constexpr bool storesInline() { return fitsInline<std::decay_t<F>>; }
+
+        Delegate(Delegate&& other) noexcept : invoker(other.invoker), mover(other.mover) {
+            if (mover) mover(storage, other.storage);
+            other.invoker = nullptr;
+            other.mover = nullptr;
+        }
+
+        Delegate& operator=(Delegate&& other) noexcept {
+            if (this != &other) {
+                reset();
+                invoker = other.invoker;
+                mover = other.mover;
+                if (mover) mover(storage, other.storage);
+                other.invoker = nullptr;
+                other.mover = nullptr;
+            }
+            return *this;
+        }
+
+        Delegate(const Delegate&) = delete;
+        Delegate& operator=(const Delegate&) = delete;
+
+        ~Delegate() { reset(); }
+
+        explicit operator bool() const { return invoker != nullptr; }
+
+        R operator()(Args... args) const {
+            return invoker(const_cast<unsigned char*>(storage), std::forward<Args>(args)...);
+        }
+    };
+
+    // 리스너 구독 핸들 (removeListener에 전달)
+    struct ListenerHandle {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+    // 이벤트 통계
+    struct EventStats {
+        uint64_t queued;
+        uint64_t dropped;
+        uint64_t dispatched;
+    };
+
+    // 이벤트 시스템
+    // broadcast: 호출한 스레드에서 즉시 모든 리스너 호출 (동기)
+    // post + dispatch: 큐 모드. 생산자는 링 버퍼에 넣기만 하고 프레임마다 dispatch()가 한꺼번에 처리
+    // 리스너는 Delegate로 보관하므로 broadcast 중 힙 할당이 없다.
+    // NoexceptListeners가 true이면 리스너가 예외를 던지지 않는다고 보고 try/catch를 생략한다.
+    template<typename T, bool NoexceptListeners = false>
     class EventSystem {
+    public:
+        using Callback = Delegate<void(const T&)>;
+        using Filter = Delegate<bool(const T&)>;
+
     private:
-        std::vector<std::function<void(const T&)>> listeners;
+        struct ListenerEntry {
+            Callback callback;
+            Filter filter;    // 비어 있으면 모든 이벤트 수신
+            uint32_t generation = 0;
+            bool alive = false;
+        };
+
+        std::deque<ListenerEntry> listeners;    // 추가해도 기존 항목 주소가 바뀌지 않음
+        std::vector<uint32_t> freeSlots;
+        std::vector<uint32_t> pendingFreeSlots; // broadcast 중에 해제된 슬롯 (끝난 뒤 freeSlots로)
+        size_t broadcastDepth = 0;              // 리스너 안에서 다시 broadcast할 수 있으므로 깊이로 셈
+
+        // broadcast 범위를 벗어날 때 미뤄 둔 슬롯을 재사용 목록으로 옮김 (예외로 빠져나가도)
+        struct BroadcastScope {
+            EventSystem& owner;
+            explicit BroadcastScope(EventSystem& system) : owner(system) { ++owner.broadcastDepth; }
+            ~BroadcastScope() {
+                if (--owner.broadcastDepth == 0) {
+                    owner.freeSlots.insert(owner.freeSlots.end(),
+                                           owner.pendingFreeSlots.begin(), owner.pendingFreeSlots.end());
+                    owner.pendingFreeSlots.clear();
+                }
+            }
+        };
+        std::unique_ptr<MpscRingBuffer<T>> queue;
+        std::atomic<uint64_t> queuedCount{0};
+        std::atomic<uint64_t> droppedCount{0};
+        std::atomic<uint64_t> dispatchedCount{0};
 
     public:
-        void addListener(std::function<void(const T&)> listener) {
-            listeners.push_back(listener);
+        // 필터가 있으면 true를 돌려준 이벤트만 전달
+        ListenerHandle addListener(Callback listener, Filter filter = nullptr) {
+            uint32_t index;
+            if (!freeSlots.empty()) {
+                index = freeSlots.back();
+                freeSlots.pop_back();
+            } else {
+                index = static_cast<uint32_t>(listeners.size());
+                listeners.emplace_back();
+            }
+            ListenerEntry& entry = listeners[index];
+            entry.callback = std::move(listener);
+            entry.filter = std::move(filter);
+            entry.alive = true;
+            return {index, entry.generation};
+        }
+
+        // O(1) 구독 해제. 이미 해제된 핸들이면 false
+        // broadcast 중이면 슬롯 재사용을 끝날 때까지 미룬다 (실행 중인 콜백을 덮어쓰지 않도록)
+        bool removeListener(ListenerHandle handle) {
+            if (handle.index >= listeners.size()) return false;
+            ListenerEntry& entry = listeners[handle.index];
+            if (!entry.alive || entry.generation != handle.generation) return false;
+            entry.alive = false;
+            ++entry.generation;
+            if (broadcastDepth > 0) pendingFreeSlots.push_back(handle.index);
+            else freeSlots.push_back(handle.index);
+            return true;
         }
 
         void broadcast(const T& event) {
-            for (auto& listener : listeners) {
-                try {
-                    listener(event);
-                } catch (const std::exception& e) {
-                    std::cout << "이벤트 처리 오류: " << e.what() << std::endl;
+            // 인덱스로 순회하고 해제된 슬롯은 broadcast가 끝난 뒤에 재사용하므로
+            // 리스너 안에서 구독하거나 (자기 자신을 포함해) 해제해도 안전
+            BroadcastScope scope(*this);
+            for (size_t i = 0; i < listeners.size(); ++i) {
+                const ListenerEntry& listener = listeners[i];
+                if (!listener.alive) continue;
+                if (listener.filter && !listener.filter(event)) continue;
+                if constexpr (NoexceptListeners) {
+                    listener.callback(event);
+                } else {
+                    try {
+                        listener.callback(event);
+                    } catch (const std::exception& e) {
+                        std::cout << "이벤트 처리 오류: " << e.what() << std::endl;
+                    }
+                }
+            }
+        }
+
+        // 큐 모드 활성화 (이미 큐에 있는 이벤트가 없을 때 호출)
+        void enableQueue(size_t capacity = 4096) {
+            queue = std::make_unique<MpscRingBuffer<T>>(capacity);
+        }
+
+        bool isQueued() const { return queue != nullptr; }
+
+        // 여러 스레드에서 호출 가능. 큐 모드가 아니면 즉시 broadcast
+        // 큐가 가득 차면 이벤트를 버리고 false 반환
+        bool post(const T& event) {
+            if (!queue) {
+                broadcast(event);
+                dispatchedCount.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            if (!queue->tryPush(event)) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            queuedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // 소비자 스레드에서 프레임당 한 번 호출. 최대 maxEvents개를 처리하고 처리한 개수 반환
+        size_t dispatch(size_t maxEvents = SIZE_MAX) {
+            if (!queue) return 0;
+
+            size_t count = 0;
+            T event;
+            while (count < maxEvents && queue->tryPop(event)) {
+                broadcast(event);
+                ++count;
+            }
+            dispatchedCount.fetch_add(count, std::memory_order_relaxed);
+            return count;
+        }
+
+        EventStats getStats() const {
+            return {queuedCount.load(std::memory_order_relaxed),
+                    droppedCount.load(std::memory_order_relaxed),
+                    dispatchedCount.load(std::memory_order_relaxed)};
+        }
+    };
+
+    // 병렬 구간에서 발생한 이벤트를 모아 두었다가 정해진 순서로 재생
+    // 청크 번호별로 버퍼를 나누므로 스레드 수와 관계없이 재생 순서가 같다.
+    template<typename T>
+    class DeferredEvents {
+    private:
+        std::vector<std::vector<T>> chunks;
+
+    public:
+        void reset(size_t chunkCount) {
+            chunks.resize(chunkCount);
+            for (auto& chunk : chunks) chunk.clear();
+        }
+
+        // 같은 청크는 한 스레드만 처리하므로 잠금이 필요 없다
+        void push(size_t chunkIndex, const T& event) {
+            chunks[chunkIndex].push_back(event);
+        }
+
+        void replay(EventSystem<T>& target) {
+            for (auto& chunk : chunks) {
+                for (const auto& event : chunk) target.broadcast(event);
+                chunk.clear();
+            }
+        }
+    };
+
+    // 작업 훔치기(work-stealing) 작업 스케줄러
+    // 작업자마다 자기 큐를 갖고, 큐가 비면 다른 작업자 큐의 앞쪽에서 훔쳐 온다.
+    // parallelFor를 호출한 스레드도 작업에 참여한다.
+    // 작업이 예외를 던지면 남은 청크는 건너뛰고, 모든 청크가 끝난 뒤 첫 예외를 호출자에게 다시 던진다.
+    class JobSystem {
+    public:
+        // (begin, end, chunkIndex)
+        using RangeJob = std::function<void(size_t, size_t, size_t)>;
+
+    private:
+        struct Task {
+            size_t begin, end, chunkIndex;
+        };
+
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+        std::mutex wakeMutex;
+        std::condition_variable wakeCondition;
+        std::condition_variable doneCondition;
+        const RangeJob* currentJob;
+        std::atomic<size_t> remaining;
+        size_t generation;
+        bool stopping;
+
+        std::mutex errorMutex;
+        std::exception_ptr firstError;      // 이번 parallelFor에서 처음 난 예외
+        std::atomic<bool> failed;
+
+        bool popTask(size_t self, Task& task) {
+            {
+                WorkerQueue& own = *queues[self];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty()) {
+                    task = own.tasks.back();
+                    own.tasks.pop_back();
+                    return true;
+                }
+            }
+            for (size_t offset = 1; offset < queues.size(); ++offset) {
+                WorkerQueue& victim = *queues[(self + offset) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void runTasks(size_t self) {
+            Task task;
+            while (popTask(self, task)) {
+                if (!failed.load(std::memory_order_relaxed)) {
+                    try {
+                        (*currentJob)(task.begin, task.end, task.chunkIndex);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!firstError) firstError = std::current_exception();
+                        failed.store(true, std::memory_order_relaxed);
+                    }
                 }
+                // 예외가 나도 청크는 끝난 것으로 세어야 호출자가 job을 놓기 전에 모두 멈춘다
+                if (remaining.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    doneCondition.notify_all();
+                }
+            }
+        }
+
+        void workerLoop(size_t self) {
+            size_t seenGeneration = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(wakeMutex);
+                    wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                    if (stopping) return;
+                    seenGeneration = generation;
+                }
+                runTasks(self);
+            }
+        }
+
+    public:
+        // workerCount: 호출 스레드를 포함한 전체 스레드 수 (1이면 단일 스레드)
+        explicit JobSystem(size_t workerCount = std::thread::hardware_concurrency())
+            : currentJob(nullptr), remaining(0), generation(0), stopping(false), failed(false) {
+            workerCount = std::max<size_t>(1, workerCount);
+            for (size_t i = 0; i < workerCount; ++i) {
+                queues.push_back(std::make_unique<WorkerQueue>());
+            }
+            for (size_t i = 1; i < workerCount; ++i) {
+                workers.emplace_back(&JobSystem::workerLoop, this, i);
+            }
+        }
+
+        ~JobSystem() {
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                stopping = true;
+            }
+            wakeCondition.notify_all();
+            for (auto& worker : workers) worker.join();
+        }
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        size_t getWorkerCount() const { return queues.size(); }
+
+        static size_t chunkCount(size_t count, size_t chunkSize) {
+            chunkSize = std::max<size_t>(1, chunkSize);
+            return (count + chunkSize - 1) / chunkSize;
+        }
+
+        // [0, count)를 chunkSize 단위로 나눠 병렬 실행하고 모두 끝날 때까지 대기
+        void parallelFor(size_t count, size_t chunkSize, const RangeJob& job) {
+            size_t chunks = chunkCount(count, chunkSize);
+            if (chunks == 0) return;
+            chunkSize = std::max<size_t>(1, chunkSize);
+
+            if (queues.size() == 1 || chunks == 1) {
+                for (size_t c = 0; c < chunks; ++c) {
+                    job(c * chunkSize, std::min(count, (c + 1) * chunkSize), c);
+                }
+                return;
+            }
+
+            currentJob = &job;
+            firstError = nullptr;
+            failed.store(false);
+            remaining.store(chunks);
+            for (size_t c = 0; c < chunks; ++c) {
+                WorkerQueue& queue = *queues[c % queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back({c * chunkSize, std::min(count, (c + 1) * chunkSize), c});
             }
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                ++generation;
+            }
+            wakeCondition.notify_all();
+
+            runTasks(0);
+
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                doneCondition.wait(lock, [&] { return remaining.load() == 0; });
+                currentJob = nullptr;
+            }
+            if (firstError) std::rethrow_exception(std::exchange(firstError, nullptr));
         }
     };
 
+    // 접촉 단계 (ContactCache 사용 시)
+    enum class ContactPhase {
+        ENTER,      // 이번 프레임에 처음 닿음
+        STAY,       // 계속 닿아 있음
+        EXIT        // 이번 프레임에 떨어짐
+    };
+
     // 게임 이벤트 타입들
     struct CollisionEvent {
         std::string object1, object2;
         Vector2D position;
+        ContactPhase phase = ContactPhase::ENTER;
     };
 
     struct ScoreEvent {
@@ -124,6 +911,88 @@ namespace GameEngine {
         std::string playerName;
     };
 
+    // 풀 통계
+    struct PoolStats {
+        size_t live;        // 사용 중인 객체 수
+        size_t peak;        // 최대 동시 사용 수
+        size_t free;        // 재사용 대기 중인 칸 수
+        size_t capacity;    // 확보한 전체 칸 수
+    };
+
+    // 타입별 고정 크기 객체 풀
+    // 블록 단위로 메모리를 확보하고, 해제된 칸은 free list로 돌려 다음 생성 때 재사용한다.
+    // 확보한 블록은 프로그램 종료까지 반환하지 않으므로 생성/삭제를 반복해도 힙이 조각나지 않는다.
+    template<typename T, size_t BlockSize = 256>
+    class ObjectPool {
+    private:
+        union Slot {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        std::vector<std::unique_ptr<Slot[]>> blocks;
+        Slot* freeList;
+        size_t live, peak, freeCount;
+        std::mutex mutex;
+
+        ObjectPool() : freeList(nullptr), live(0), peak(0), freeCount(0) {}
+
+        void grow() {
+            blocks.emplace_back(new Slot[BlockSize]);
+            Slot* block = blocks.back().get();
+            for (size_t i = 0; i < BlockSize; ++i) {
+                block[i].next = freeList;
+                freeList = &block[i];
+            }
+            freeCount += BlockSize;
+        }
+
+    public:
+        static ObjectPool& instance() {
+            static ObjectPool pool;
+            return pool;
+        }
+
+        // size가 T와 다르면 (T를 상속한 더 큰 클래스) 일반 new로 처리
+        void* allocate(size_t size) {
+            if (size != sizeof(T)) return ::operator new(size);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!freeList) grow();
+            Slot* slot = freeList;
+            freeList = slot->next;
+            --freeCount;
+            peak = std::max(peak, ++live);
+            return slot;
+        }
+
+        void deallocate(void* pointer, size_t size) {
+            if (!pointer) return;
+            if (size != sizeof(T)) {
+                ::operator delete(pointer);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            Slot* slot = static_cast<Slot*>(pointer);
+            slot->next = freeList;
+            freeList = slot;
+            ++freeCount;
+            --live;
+        }
+
+        PoolStats getStats() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return {live, peak, freeCount, blocks.size() * BlockSize};
+        }
+    };
+
+    // 클래스 전용 operator new/delete를 ObjectPool로 연결
+    // make_unique와 unique_ptr 소멸이 그대로 풀을 사용하게 된다.
+    #define GAME_ENGINE_POOLED(Type) \
+        static void* operator new(size_t size) { return ObjectPool<Type>::instance().allocate(size); } \
+        static void operator delete(void* pointer, size_t size) { ObjectPool<Type>::instance().deallocate(pointer, size); }
+
     // 게임 객체 기본 클래스 (추상 클래스)
     class GameObject {
     protected:
@@ -134,13 +1003,55 @@ namespace GameEngine {
         static int nextId;
         int id;
 
+        // id 발급: IdScope가 연결한 월드별 카운터가 있으면 그것을, 없으면 전역 카운터(nextId)를 쓴다
+        inline static std::mutex nextIdMutex;   // 여러 스레드가 nextId를 함께 쓸 때 보호
+        inline static thread_local int* scopedNextId = nullptr;
+
+        // 렌더 보간용 직전 틱 상태
+        Vector2D previousPosition;
+        bool hasPreviousState = false;
+
+        friend class WorldSnapshot;     // 복원 시 id 재설정
+
     public:
+        // 생성자는 id(allocateId())로 id를 받는다 (기존 id(nextId++)도 컴파일되지만 IdScope를 따르지 않음)
         GameObject(const std::string& n, Vector2D pos = Vector2D());
         virtual ~GameObject() = default;
 
+        // 월드별 id 범위: 살아 있는 동안 이 스레드에서 만드는 객체는 counter에서 id를 받는다
+        // (병렬로 도는 월드들이 카운터를 공유하지 않고, 같은 시드와 입력이면 id도 같아짐)
+        class IdScope {
+        private:
+            int* previous;
+
+        public:
+            explicit IdScope(int& counter) : previous(scopedNextId) { scopedNextId = &counter; }
+            ~IdScope() { scopedNextId = previous; }
+
+            IdScope(const IdScope&) = delete;
+            IdScope& operator=(const IdScope&) = delete;
+        };
+
+        static int allocateId() {
+            if (scopedNextId) return (*scopedNextId)++;
+            std::lock_guard<std::mutex> lock(nextIdMutex);
+            return nextId++;
+        }
+
+        // 이후 발급하는 id가 restoredId보다 크도록 (스냅샷 복원용)
+        static void reserveIdsThrough(int restoredId) {
+            if (scopedNextId) {
+                *scopedNextId = std::max(*scopedNextId, restoredId + 1);
+                return;
+            }
+            std::lock_guard<std::mutex> lock(nextIdMutex);
+            nextId = std::max(nextId, restoredId + 1);
+        }
+
         // 순수 가상 함수
         virtual void update(float deltaTime) = 0;
         virtual void render() const = 0;
+        virtual ObjectType getObjectType() const = 0;
 
         // 가상 함수
         virtual void onCollision(GameObject* other) {}
@@ -157,6 +1068,17 @@ namespace GameEngine {
         void setVelocity(const Vector2D& vel) { velocity = vel; }
         void setActive(bool isActive) { active = isActive; }
 
+        // 고정 틱 직전에 호출해서 현재 위치를 보관
+        void storePreviousState() {
+            previousPosition = position;
+            hasPreviousState = true;
+        }
+
+        // 직전 틱과 현재 틱 사이 위치 (alpha: 0 = 직전, 1 = 현재)
+        Vector2D getInterpolatedPosition(float alpha) const {
+            return hasPreviousState ? previousPosition.lerp(position, alpha) : position;
+        }
+
         // 충돌 검사
         virtual bool checkCollision(const GameObject* other) const;
 
@@ -171,12 +1093,15 @@ namespace GameEngine {
         int score;
         float speed;
 
+        friend class WorldSnapshot;     // 체력/점수 저장 및 복원
+
     public:
         Player(const std::string& name, Vector2D pos = Vector2D(0, 0));
 
         void update(float deltaTime) override;
         void render() const override;
         void onCollision(GameObject* other) override;
+        ObjectType getObjectType() const override { return ObjectType::PLAYER; }
 
         // 플레이어 전용 메서드
         void takeDamage(int damage);
@@ -201,13 +1126,17 @@ namespace GameEngine {
 
     public:
         Enemy(const std::string& name, Vector2D pos = Vector2D(0, 0));
+        GAME_ENGINE_POOLED(Enemy)
 
         void update(float deltaTime) override;
         void render() const override;
         void onCollision(GameObject* other) override;
+        ObjectType getObjectType() const override { return ObjectType::ENEMY; }
 
         void setTarget(const Vector2D& target) { targetPosition = target; }
+        const Vector2D& getTarget() const { return targetPosition; }
         int getDamage() const { return damage; }
+        float getSpeed() const { return speed; }
     };
 
     // 아이템 클래스
@@ -218,51 +1147,1177 @@ namespace GameEngine {
 
     public:
         Item(const std::string& name, const std::string& type, int val, Vector2D pos = Vector2D(0, 0));
+        GAME_ENGINE_POOLED(Item)
 
         void update(float deltaTime) override;
         void render() const override;
         void onCollision(GameObject* other) override;
+        ObjectType getObjectType() const override { return ObjectType::ITEM; }
 
         int getValue() const { return value; }
         const std::string& getType() const { return itemType; }
     };
 
-    // 게임 월드 관리자
-    class GameWorld {
+    // 닫힌 타입 목록 기반 월드 컨테이너
+    // 타입마다 별도의 vector에 값으로 저장하고, 타입별 루프에서 T::update처럼
+    // 한정된 이름으로 호출하므로 가상 호출 없이 인라인될 수 있다.
+    // GameWorld의 unique_ptr<GameObject> 경로와 같은 객체 API를 그대로 사용한다.
+    template<typename... Types>
+    class TypedWorld {
     private:
-        std::vector<std::unique_ptr<GameObject>> gameObjects;
-        std::unique_ptr<Player> player;
-        GameState currentState;
-        float worldWidth, worldHeight;
+        std::tuple<std::vector<Types>...> storage;
 
-        // 이벤트 시스템
-        EventSystem<CollisionEvent> collisionEvents;
-        EventSystem<ScoreEvent> scoreEvents;
+        template<typename T>
+        void updateAll(float deltaTime) {
+            for (auto& obj : std::get<std::vector<T>>(storage)) {
+                if (obj.isActive()) obj.T::update(deltaTime);
+            }
+        }
 
-        // 랜덤 생성기
-        std::random_device rd;
-        std::mt19937 gen;
-        std::uniform_real_distribution<float> posDist;
+        template<typename T>
+        void renderAll() const {
+            for (const auto& obj : std::get<std::vector<T>>(storage)) {
+                if (obj.isActive()) obj.T::render();
+            }
+        }
 
     public:
-        GameWorld(float width = 800, float height = 600);
-        ~GameWorld() = default;
+        template<typename T, typename... Args>
+        T& spawn(Args&&... args) {
+            auto& objects = std::get<std::vector<T>>(storage);
+            objects.emplace_back(std::forward<Args>(args)...);
+            return objects.back();
+        }
 
-        // 게임 오브젝트 관리
-        void addGameObject(std::unique_ptr<GameObject> obj);
-        void removeGameObject(const std::string& name);
-        GameObject* findGameObject(const std::string& name);
+        template<typename T>
+        std::vector<T>& all() { return std::get<std::vector<T>>(storage); }
 
-        // 플레이어 관리
-        void setPlayer(std::unique_ptr<Player> p);
-        Player* getPlayer() const { return player.get(); }
+        template<typename T>
+        const std::vector<T>& all() const { return std::get<std::vector<T>>(storage); }
 
-        // 게임 루프
-        void update(float deltaTime);
-        void render() const;
+        void reserve(size_t perType) {
+            (std::get<std::vector<Types>>(storage).reserve(perType), ...);
+        }
 
-        // 충돌 검사
+        // 타입 순서대로 각 타입 전체를 한 번에 업데이트
+        void update(float deltaTime) { (updateAll<Types>(deltaTime), ...); }
+        void render() const { (renderAll<Types>(), ...); }
+
+        // 모든 객체 방문: fn(auto& obj)는 타입별로 따로 인스턴스화됨
+        template<typename Fn>
+        void forEach(Fn&& fn) {
+            auto visit = [&](auto& objects) {
+                for (auto& obj : objects) fn(obj);
+            };
+            (visit(std::get<std::vector<Types>>(storage)), ...);
+        }
+
+        size_t size() const { return (std::get<std::vector<Types>>(storage).size() + ... + 0); }
+
+        void clear() { (std::get<std::vector<Types>>(storage).clear(), ...); }
+    };
+
+    using StaticGameWorld = TypedWorld<Player, Enemy, Item>;
+
+    // 바이너리 월드 스냅샷
+    // 파일 구조: Header 1개 + Record 배열 (고정 크기, 패딩 없이 그대로 기록) + 문자열 테이블
+    // 저장은 버퍼 하나를 한 번에 write하고, 복원은 파일을 매핑(또는 한 번에 read)한 뒤
+    // Record 배열을 그대로 읽으므로 필드별 파싱이 없다.
+    // 이름과 아이템 종류는 길이 제한 없이 문자열 테이블에 두고 Record에는 위치만 저장한다.
+    class WorldSnapshot {
+    public:
+        static constexpr uint32_t Version = 2;
+
+        struct Header {
+            char magic[4];          // "GWSN"
+            uint32_t version;
+            uint32_t state;         // GameState
+            uint32_t reserved;
+            uint64_t count;
+            uint64_t stringBytes;   // Record 배열 뒤 문자열 테이블 크기
+        };
+
+        // 문자열 테이블 안의 위치
+        struct StringRef {
+            uint32_t offset;
+            uint32_t length;
+        };
+
+        struct Record {
+            uint8_t type;           // ObjectType
+            uint8_t active;
+            uint16_t reserved;
+            int32_t id;
+            float x, y, vx, vy;
+            int32_t health, score, value;
+            StringRef name;
+            StringRef itemType;
+        };
+
+        static_assert(std::is_trivially_copyable<Record>::value, "Record는 memcpy 가능해야 함");
+
+        // 문자열은 strings 뒤에 붙이고 Record에는 위치만 기록
+        static Record makeRecord(const GameObject& obj, std::string& strings) {
+            Record record;
+            std::memset(&record, 0, sizeof(record));
+            record.type = static_cast<uint8_t>(obj.getObjectType());
+            record.active = obj.isActive() ? 1 : 0;
+            record.id = obj.getId();
+            record.x = obj.getPosition().x;
+            record.y = obj.getPosition().y;
+            record.vx = obj.getVelocity().x;
+            record.vy = obj.getVelocity().y;
+            record.name = appendString(strings, obj.getName());
+
+            if (auto player = dynamic_cast<const Player*>(&obj)) {
+                record.health = player->health;
+                record.score = player->score;
+            } else if (auto item = dynamic_cast<const Item*>(&obj)) {
+                record.value = item->getValue();
+                record.itemType = appendString(strings, item->getType());
+            }
+            return record;
+        }
+
+        class View;
+
+        // Record에서 객체 생성 (id, 속도, 활성 여부, 플레이어 체력/점수까지 복원)
+        static std::unique_ptr<GameObject> instantiate(const Record& record, const View& view) {
+            std::unique_ptr<GameObject> obj;
+            Vector2D pos(record.x, record.y);
+            std::string name = view.text(record.name);
+            switch (static_cast<ObjectType>(record.type)) {
+                case ObjectType::PLAYER: {
+                    auto player = std::make_unique<Player>(name, pos);
+                    player->health = record.health;
+                    player->score = record.score;
+                    obj = std::move(player);
+                    break;
+                }
+                case ObjectType::ENEMY:
+                    obj = std::make_unique<Enemy>(name, pos);
+                    break;
+                case ObjectType::ITEM:
+                    obj = std::make_unique<Item>(name, view.text(record.itemType), record.value, pos);
+                    break;
+                default:
+                    throw GameException("스냅샷에 알 수 없는 객체 종류: " + std::to_string(record.type));
+            }
+            obj->id = record.id;
+            obj->setVelocity(Vector2D(record.vx, record.vy));
+            obj->setActive(record.active != 0);
+            GameObject::reserveIdsThrough(record.id);
+            return obj;
+        }
+
+        // Header + Record들 + 문자열 테이블을 버퍼 하나로 만들어 한 번에 기록
+        static void write(const std::string& filename, GameState state, const std::vector<Record>& records,
+                          const std::string& strings) {
+            Header header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, "GWSN", 4);
+            header.version = Version;
+            header.state = static_cast<uint32_t>(state);
+            header.count = records.size();
+            header.stringBytes = strings.size();
+
+            size_t recordBytes = records.size() * sizeof(Record);
+            std::vector<char> buffer(sizeof(Header) + recordBytes + strings.size());
+            std::memcpy(buffer.data(), &header, sizeof(Header));
+            if (!records.empty()) {
+                std::memcpy(buffer.data() + sizeof(Header), records.data(), recordBytes);
+            }
+            if (!strings.empty()) {
+                std::memcpy(buffer.data() + sizeof(Header) + recordBytes, strings.data(), strings.size());
+            }
+
+            std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                throw GameException("스냅샷 파일을 생성할 수 없음: " + filename);
+            }
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            if (!file) {
+                throw GameException("스냅샷 쓰기 실패: " + filename);
+            }
+        }
+
+        // 읽기 전용 스냅샷 뷰 (POSIX에서는 mmap, 그 외에는 한 번의 read)
+        class View {
+        private:
+            const char* data;
+            size_t length;
+            std::vector<char> fallback;
+#ifdef GAME_ENGINE_POSIX
+            void* mapping = nullptr;
+#endif
+
+        public:
+            explicit View(const std::string& filename) : data(nullptr), length(0) {
+#ifdef GAME_ENGINE_POSIX
+                int fd = ::open(filename.c_str(), O_RDONLY);
+                if (fd < 0) throw GameException("스냅샷 파일을 열 수 없음: " + filename);
+                struct stat info;
+                if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+                    length = static_cast<size_t>(info.st_size);
+                    mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (mapping == MAP_FAILED) mapping = nullptr;
+                }
+                ::close(fd);
+                if (mapping) {
+                    data = static_cast<const char*>(mapping);
+                }
+#endif
+                if (!data) {
+                    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+                    if (!file.is_open()) throw GameException("스냅샷 파일을 열 수 없음: " + filename);
+                    length = static_cast<size_t>(file.tellg());
+                    fallback.resize(length);
+                    file.seekg(0);
+                    file.read(fallback.data(), static_cast<std::streamsize>(length));
+                    data = fallback.data();
+                }
+                try {
+                    validate(filename);
+                } catch (...) {
+                    // 생성자가 끝나지 않으면 소멸자가 불리지 않으므로 매핑을 직접 해제
+#ifdef GAME_ENGINE_POSIX
+                    if (mapping) ::munmap(mapping, length);
+#endif
+                    throw;
+                }
+            }
+
+            ~View() {
+#ifdef GAME_ENGINE_POSIX
+                if (mapping) ::munmap(mapping, length);
+#endif
+            }
+
+            View(const View&) = delete;
+            View& operator=(const View&) = delete;
+
+            const Header& header() const { return *reinterpret_cast<const Header*>(data); }
+            GameState state() const { return static_cast<GameState>(header().state); }
+            size_t size() const { return static_cast<size_t>(header().count); }
+            const Record* records() const { return reinterpret_cast<const Record*>(data + sizeof(Header)); }
+
+            // 문자열 테이블에서 꺼냄 (손상된 파일이면 테이블 밖을 읽지 않고 GameException)
+            std::string text(const StringRef& ref) const {
+                const uint64_t tableSize = header().stringBytes;
+                if (ref.offset > tableSize || ref.length > tableSize - ref.offset) {
+                    throw GameException("스냅샷 문자열 위치가 잘못됨");
+                }
+                const char* table = data + sizeof(Header) + size() * sizeof(Record);
+                return std::string(table + ref.offset, ref.length);
+            }
+
+        private:
+            void validate(const std::string& filename) const {
+                if (length < sizeof(Header) || std::memcmp(header().magic, "GWSN", 4) != 0) {
+                    throw GameException("스냅샷 형식이 아님: " + filename);
+                }
+                if (header().version != Version) {
+                    throw GameException("지원하지 않는 스냅샷 버전: " + std::to_string(header().version));
+                }
+                // 곱셈/덧셈 넘침 없이 Record 배열과 문자열 테이블이 파일 안에 있는지 확인
+                size_t available = length - sizeof(Header);
+                if (header().count > available / sizeof(Record) ||
+                    header().stringBytes > available - size() * sizeof(Record)) {
+                    throw GameException("스냅샷 파일이 잘림: " + filename);
+                }
+            }
+        };
+
+    private:
+        static StringRef appendString(std::string& strings, const std::string& value) {
+            if (strings.size() + value.size() > UINT32_MAX) {
+                throw GameException("스냅샷 문자열 테이블이 4GB를 넘음");
+            }
+            StringRef ref{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(value.size())};
+            strings += value;
+            return ref;
+        }
+    };
+
+    // 관전자용 델타 스트림
+    // 틱마다 직전에 보낸 상태와 비교해 생성/삭제/이동된 객체만 바이트 버퍼에 기록한다.
+    // 위치는 quantum 단위 정수로 양자화하고, id는 정렬 순서의 차이값을 varint로,
+    // 좌표 변화량은 zigzag varint로 저장한다. 인코더는 보낸 양자화 값을 기준으로
+    // 다음 델타를 만들기 때문에 오차가 누적되지 않는다.
+    //
+    // 틱 형식: tick | 생성 수, [id차, 종류, x, y, 이름 길이, 이름]... |
+    //          삭제 수, [id차]... | 이동 수, [id차, dx, dy]...
+    class DeltaStream {
+    public:
+        struct EntityState {
+            ObjectType type;
+            int32_t qx, qy;
+            std::string name;
+        };
+
+        using State = std::map<int, EntityState>;
+
+        static void writeVarint(std::vector<uint8_t>& out, uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        static void writeSigned(std::vector<uint8_t>& out, int64_t value) {
+            writeVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        // 바이트 버퍼 읽기 (범위를 넘으면 GameException)
+        class Reader {
+        private:
+            const uint8_t* cursor;
+            const uint8_t* end;
+
+        public:
+            Reader(const uint8_t* data, size_t size) : cursor(data), end(data + size) {}
+
+            bool atEnd() const { return cursor == end; }
+            const uint8_t* position() const { return cursor; }
+
+            uint8_t readByte() {
+                if (cursor == end) throw GameException("델타 스트림이 잘림");
+                return *cursor++;
+            }
+
+            uint64_t readVarint() {
+                uint64_t value = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    uint8_t byte = readByte();
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if (!(byte & 0x80)) return value;
+                }
+                throw GameException("델타 스트림의 varint가 너무 김");
+            }
+
+            int64_t readSigned() {
+                uint64_t raw = readVarint();
+                return static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+            }
+
+            std::string readString(size_t length) {
+                if (static_cast<size_t>(end - cursor) < length) throw GameException("델타 스트림이 잘림");
+                std::string text(reinterpret_cast<const char*>(cursor), length);
+                cursor += length;
+                return text;
+            }
+        };
+    };
+
+    // 델타 인코더 (서버 측, 관전자 연결마다 하나)
+    // 보낸 상태를 id 순으로 정렬된 배열로 보관하고, 이번 틱 상태와 병합하듯 한 번에 비교한다.
+    class DeltaEncoder {
+    private:
+        struct SentEntity {
+            int id;
+            int32_t qx, qy;
+        };
+
+        float quantum;
+        std::vector<SentEntity> sent;
+        std::vector<SentEntity> current;
+        std::vector<const GameObject*> currentObjects;
+        std::vector<size_t> order;
+        uint64_t tick;
+
+    public:
+        explicit DeltaEncoder(float q = 0.01f) : quantum(q), tick(0) {}
+
+        float getQuantum() const { return quantum; }
+
+        // 활성 객체 목록으로 이번 틱 델타를 out 뒤에 덧붙임
+        void encode(const std::vector<const GameObject*>& objects, std::vector<uint8_t>& out) {
+            order.clear();
+            for (size_t i = 0; i < objects.size(); ++i) {
+                if (objects[i] && objects[i]->isActive()) order.push_back(i);
+            }
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return objects[a]->getId() < objects[b]->getId();
+            });
+
+            current.clear();
+            currentObjects.clear();
+            for (size_t i : order) {
+                const GameObject* obj = objects[i];
+                current.push_back({obj->getId(),
+                                   static_cast<int32_t>(std::lround(obj->getPosition().x / quantum)),
+                                   static_cast<int32_t>(std::lround(obj->getPosition().y / quantum))});
+                currentObjects.push_back(obj);
+            }
+
+            // 정렬된 두 배열을 나란히 훑으며 생성/삭제/이동 분류
+            std::vector<size_t> spawned, moved;     // current 인덱스
+            std::vector<int> removed;
+            size_t a = 0, b = 0;
+            while (a < sent.size() || b < current.size()) {
+                if (b == current.size() || (a < sent.size() && sent[a].id < current[b].id)) {
+                    removed.push_back(sent[a++].id);
+                } else if (a == sent.size() || current[b].id < sent[a].id) {
+                    spawned.push_back(b++);
+                } else {
+                    if (sent[a].qx != current[b].qx || sent[a].qy != current[b].qy) moved.push_back(b);
+                    ++a;
+                    ++b;
+                }
+            }
+
+            DeltaStream::writeVarint(out, tick++);
+
+            DeltaStream::writeVarint(out, spawned.size());
+            int64_t previous = 0;
+            for (size_t index : spawned) {
+                const SentEntity& entity = current[index];
+                const GameObject* obj = currentObjects[index];
+                DeltaStream::writeSigned(out, static_cast<int64_t>(entity.id) - previous);
+                out.push_back(static_cast<uint8_t>(obj->getObjectType()));
+                DeltaStream::writeSigned(out, entity.qx);
+                DeltaStream::writeSigned(out, entity.qy);
+                DeltaStream::writeVarint(out, obj->getName().size());
+                out.insert(out.end(), obj->getName().begin(), obj->getName().end());
+                previous = entity.id;
+            }
+
+            DeltaStream::writeVarint(out, removed.size());
+            previous = 0;
+            for (int id : removed) {
+                DeltaStream::writeSigned(out, static_cast<int64_t>(id) - previous);
+                previous = id;
+            }
+
+            // 이동은 직전 값이 필요하므로 sent를 다시 찾아 계산 (둘 다 id 정렬)
+            DeltaStream::writeVarint(out, moved.size());
+            previous = 0;
+            size_t cursor = 0;
+            for (size_t index : moved) {
+                const SentEntity& after = current[index];
+                while (sent[cursor].id < after.id) ++cursor;
+                const SentEntity& before = sent[cursor];
+                DeltaStream::writeSigned(out, static_cast<int64_t>(after.id) - previous);
+                DeltaStream::writeSigned(out, static_cast<int64_t>(after.qx) - before.qx);
+                DeltaStream::writeSigned(out, static_cast<int64_t>(after.qy) - before.qy);
+                previous = after.id;
+            }
+
+            sent.swap(current);
+        }
+    };
+
+    // 델타 적용기 (관전자 측)
+    class DeltaDecoder {
+    private:
+        float quantum;
+        DeltaStream::State state;
+        uint64_t lastTick;
+
+        // base + delta를 int32 범위 안에서만 계산 (조작된 스트림으로 정수 넘침이 생기지 않게)
+        static int32_t addChecked(int32_t base, int64_t delta) {
+            if (delta > INT32_MAX - static_cast<int64_t>(base) || delta < INT32_MIN - static_cast<int64_t>(base)) {
+                throw GameException("델타 스트림 값이 int 범위를 벗어남");
+            }
+            return static_cast<int32_t>(base + delta);
+        }
+
+    public:
+        explicit DeltaDecoder(float q = 0.01f) : quantum(q), lastTick(0) {}
+
+        // 한 틱 분량의 델타를 적용하고 읽은 바이트 수 반환
+        size_t apply(const uint8_t* data, size_t size) {
+            DeltaStream::Reader reader(data, size);
+            lastTick = reader.readVarint();
+
+            uint64_t count = reader.readVarint();
+            int32_t id = 0;
+            for (uint64_t i = 0; i < count; ++i) {
+                id = addChecked(id, reader.readSigned());
+                DeltaStream::EntityState entity;
+                entity.type = static_cast<ObjectType>(reader.readByte());
+                entity.qx = addChecked(0, reader.readSigned());
+                entity.qy = addChecked(0, reader.readSigned());
+                entity.name = reader.readString(static_cast<size_t>(reader.readVarint()));
+                state[id] = std::move(entity);
+            }
+
+            count = reader.readVarint();
+            id = 0;
+            for (uint64_t i = 0; i < count; ++i) {
+                id = addChecked(id, reader.readSigned());
+                state.erase(id);
+            }
+
+            count = reader.readVarint();
+            id = 0;
+            for (uint64_t i = 0; i < count; ++i) {
+                id = addChecked(id, reader.readSigned());
+                auto it = state.find(id);
+                if (it == state.end()) throw GameException("델타 스트림에 없는 객체 이동: " + std::to_string(id));
+                it->second.qx = addChecked(it->second.qx, reader.readSigned());
+                it->second.qy = addChecked(it->second.qy, reader.readSigned());
+            }
+
+            return static_cast<size_t>(reader.position() - data);
+        }
+
+        const DeltaStream::State& getState() const { return state; }
+        uint64_t getLastTick() const { return lastTick; }
+
+        Vector2D positionOf(const DeltaStream::EntityState& entity) const {
+            return Vector2D(entity.qx * quantum, entity.qy * quantum);
+        }
+    };
+
+    // 충돌 검사용 균일 격자 (브로드 페이즈)
+    // 월드를 cellSize 크기의 셀로 나누고, 같은 셀이나 이웃 셀에 있는 객체 쌍만
+    // 정밀 검사(checkCollision) 후보로 돌려준다. 매 프레임 O(n)으로 재구성한다.
+    class SpatialGrid {
+    private:
+        float cellSize;
+        int columns, rows;
+        std::vector<int> cellStart;      // 셀별 시작 오프셋 (크기: 셀 수 + 1)
+        std::vector<size_t> cellEntries; // 셀 순서로 정렬된 객체 인덱스
+        std::vector<int> objectCell;     // 객체 인덱스 -> 셀 번호 (-1: 비활성)
+        std::vector<std::vector<std::pair<size_t, size_t>>> chunkPairs;   // 병렬 수집용 청크별 목록
+
+        int cellOf(const Vector2D& pos) const {
+            int cx = static_cast<int>(pos.x / cellSize);
+            int cy = static_cast<int>(pos.y / cellSize);
+            cx = std::max(0, std::min(cx, columns - 1));
+            cy = std::max(0, std::min(cy, rows - 1));
+            return cy * columns + cx;
+        }
+
+    public:
+        explicit SpatialGrid(float cell = 32.0f) : cellSize(cell), columns(1), rows(1) {}
+
+        // 월드 크기에 맞춰 격자 크기 결정 (cellSize는 충돌 지름 이상이어야 함)
+        void resize(float worldWidth, float worldHeight) {
+            columns = std::max(1, static_cast<int>(std::ceil(worldWidth / cellSize)));
+            rows = std::max(1, static_cast<int>(std::ceil(worldHeight / cellSize)));
+        }
+
+        // 활성 객체들로 격자 재구성 (계수 정렬)
+        void rebuild(const std::vector<std::unique_ptr<GameObject>>& objects) {
+            size_t cellCount = static_cast<size_t>(columns) * rows;
+            cellStart.assign(cellCount + 1, 0);
+            objectCell.assign(objects.size(), -1);
+
+            for (size_t i = 0; i < objects.size(); ++i) {
+                if (!objects[i] || !objects[i]->isActive()) continue;
+                objectCell[i] = cellOf(objects[i]->getPosition());
+                ++cellStart[objectCell[i] + 1];
+            }
+            for (size_t c = 0; c < cellCount; ++c) {
+                cellStart[c + 1] += cellStart[c];
+            }
+
+            cellEntries.resize(cellStart[cellCount]);
+            std::vector<int> cursor(cellStart.begin(), cellStart.end() - 1);
+            for (size_t i = 0; i < objects.size(); ++i) {
+                if (objectCell[i] >= 0) {
+                    cellEntries[cursor[objectCell[i]]++] = i;
+                }
+            }
+        }
+
+        // 후보 쌍 수집 (i < j). 기존 이중 루프와 같은 순서로 이벤트가 나가도록 정렬한다.
+        void collectPairs(std::vector<std::pair<size_t, size_t>>& pairs) const {
+            pairs.clear();
+            if (cellStart.empty()) return;
+            collectRange(0, objectCell.size(), pairs);
+        }
+
+        // 병렬 수집: 객체 인덱스를 청크로 나눠 청크별 목록에 모은 뒤 청크 순서로 이어 붙인다
+        // (각 청크는 a 순서로 채워지므로 결과는 직렬 collectPairs와 똑같다)
+        void collectPairs(std::vector<std::pair<size_t, size_t>>& pairs, JobSystem& jobs, size_t chunkSize) {
+            pairs.clear();
+            if (cellStart.empty()) return;
+
+            chunkPairs.resize(JobSystem::chunkCount(objectCell.size(), chunkSize));
+            jobs.parallelFor(objectCell.size(), chunkSize, [&](size_t begin, size_t end, size_t chunk) {
+                chunkPairs[chunk].clear();
+                collectRange(begin, end, chunkPairs[chunk]);
+            });
+
+            size_t total = 0;
+            for (const auto& part : chunkPairs) total += part.size();
+            pairs.reserve(total);
+            for (const auto& part : chunkPairs) pairs.insert(pairs.end(), part.begin(), part.end());
+        }
+
+        float getCellSize() const { return cellSize; }
+
+    private:
+        // 객체 인덱스 [begin, end)를 a로 하는 쌍을 a 순서로 pairs 뒤에 붙인다
+        void collectRange(size_t begin, size_t end, std::vector<std::pair<size_t, size_t>>& pairs) const {
+            for (size_t a = begin; a < end; ++a) {
+                if (objectCell[a] < 0) continue;
+                size_t first = pairs.size();
+                int cx = objectCell[a] % columns;
+                int cy = objectCell[a] / columns;
+
+                for (int ny = std::max(0, cy - 1); ny <= std::min(rows - 1, cy + 1); ++ny) {
+                    for (int nx = std::max(0, cx - 1); nx <= std::min(columns - 1, cx + 1); ++nx) {
+                        int cell = ny * columns + nx;
+                        for (int k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                            size_t b = cellEntries[k];
+                            if (b > a) pairs.emplace_back(a, b);
+                        }
+                    }
+                }
+                std::sort(pairs.begin() + first, pairs.end());
+            }
+        }
+    };
+
+    // SoA(Structure of Arrays) 엔티티 저장소
+    // 위치/속도/활성 여부를 필드별 연속 배열로 보관해서 적분 단계가 포인터 추적이나
+    // 가상 호출 없이 한 번의 루프로 끝나도록 한다. GameObject는 slot 번호로 연결된 핸들 역할.
+    class EntityStorage {
+    private:
+        std::vector<float> posX, posY;
+        std::vector<float> velX, velY;
+        std::vector<uint8_t> active;
+        std::vector<ObjectType> types;
+        std::vector<GameObject*> handles;
+        std::vector<size_t> typeSlots[3];   // 타입별 slot 목록 (배치 시스템용)
+
+    public:
+        size_t size() const { return handles.size(); }
+        bool empty() const { return handles.empty(); }
+
+        void clear() {
+            posX.clear(); posY.clear();
+            velX.clear(); velY.clear();
+            active.clear(); types.clear(); handles.clear();
+            for (auto& slots : typeSlots) slots.clear();
+        }
+
+        void reserve(size_t count) {
+            posX.reserve(count); posY.reserve(count);
+            velX.reserve(count); velY.reserve(count);
+            active.reserve(count); types.reserve(count); handles.reserve(count);
+        }
+
+        // 객체 상태를 배열로 복사하고 slot 번호 반환
+        size_t add(GameObject* obj) {
+            size_t slot = handles.size();
+            const Vector2D& pos = obj->getPosition();
+            const Vector2D& vel = obj->getVelocity();
+            posX.push_back(pos.x); posY.push_back(pos.y);
+            velX.push_back(vel.x); velY.push_back(vel.y);
+            active.push_back(obj->isActive() ? 1 : 0);
+            types.push_back(obj->getObjectType());
+            handles.push_back(obj);
+            typeSlots[static_cast<int>(obj->getObjectType())].push_back(slot);
+            return slot;
+        }
+
+        // 배열의 최신 상태를 객체(핸들)에 되돌려 쓰기
+        void writeBack() const {
+            for (size_t i = 0; i < handles.size(); ++i) {
+                handles[i]->setPosition(Vector2D(posX[i], posY[i]));
+                handles[i]->setVelocity(Vector2D(velX[i], velY[i]));
+                handles[i]->setActive(active[i] != 0);
+            }
+        }
+
+        // 적분 단계: position += velocity * deltaTime
+        void integrate(float deltaTime) {
+            const size_t count = handles.size();
+            float* px = posX.data();
+            float* py = posY.data();
+            const float* vx = velX.data();
+            const float* vy = velY.data();
+            const uint8_t* act = active.data();
+            for (size_t i = 0; i < count; ++i) {
+                float mask = act[i] ? 1.0f : 0.0f;
+                px[i] += vx[i] * deltaTime * mask;
+                py[i] += vy[i] * deltaTime * mask;
+            }
+        }
+
+        // 타입별 배치 처리: fn(slot)을 해당 타입의 활성 엔티티마다 호출
+        template<typename Fn>
+        void forEachOfType(ObjectType type, Fn&& fn) {
+            for (size_t slot : typeSlots[static_cast<int>(type)]) {
+                if (active[slot]) fn(slot);
+            }
+        }
+
+        const std::vector<size_t>& slotsOfType(ObjectType type) const {
+            return typeSlots[static_cast<int>(type)];
+        }
+
+        // 필드 접근
+        float& x(size_t slot) { return posX[slot]; }
+        float& y(size_t slot) { return posY[slot]; }
+        float& vx(size_t slot) { return velX[slot]; }
+        float& vy(size_t slot) { return velY[slot]; }
+        bool isActive(size_t slot) const { return active[slot] != 0; }
+        void setActive(size_t slot, bool value) { active[slot] = value ? 1 : 0; }
+        ObjectType typeOf(size_t slot) const { return types[slot]; }
+        GameObject* handle(size_t slot) const { return handles[slot]; }
+
+        // 배치 커널(VectorBatch)에 넘길 원시 배열
+        float* xData() { return posX.data(); }
+        float* yData() { return posY.data(); }
+        float* vxData() { return velX.data(); }
+        float* vyData() { return velY.data(); }
+    };
+
+    // 활동 등급
+    enum class ActivityTier {
+        ACTIVE,     // 매 프레임 (activeInterval마다) 업데이트
+        DORMANT     // 정지 상태이고 플레이어 관심 반경 밖: dormantInterval마다 업데이트
+    };
+
+    struct ActivityConfig {
+        bool enabled = false;
+        float interestRadius = 300.0f;
+        int activeInterval = 1;
+        int dormantInterval = 4;    // 예: 4프레임에 한 번
+        int wakeFrames = 30;        // wake 후 위치/속도와 관계없이 ACTIVE로 두는 프레임 수
+    };
+
+    struct ActivityCounters {
+        size_t active;
+        size_t dormant;
+        size_t skipped;     // 이번 프레임에 건너뛴 업데이트 수
+    };
+
+    // 휴면 객체 선별
+    // 속도가 0이고 플레이어의 관심 반경 밖인 객체를 DORMANT로 분류해 업데이트 빈도를 낮춘다.
+    // 관심 반경 안으로 들어오거나 충돌(wake)하면 즉시 ACTIVE가 되고, wake는 wakeFrames 동안 유지된다.
+    // 같은 등급의 객체는 slot 번호로 프레임을 나눠 갖기 때문에 부하가 한 프레임에 몰리지 않는다.
+    class ActivityManager {
+    private:
+        ActivityConfig config;
+        std::vector<ActivityTier> tiers;
+        std::vector<uint8_t> wokenThisFrame;
+        std::vector<int> wakeFramesLeft;    // 프레임을 넘어 유지되는 wake 타이머
+        ActivityCounters counters;
+        uint64_t frame;
+
+        int intervalOf(ActivityTier tier) const {
+            return std::max(1, tier == ActivityTier::DORMANT ? config.dormantInterval : config.activeInterval);
+        }
+
+    public:
+        ActivityManager() : counters{0, 0, 0}, frame(0) {}
+
+        void setConfig(const ActivityConfig& newConfig) { config = newConfig; }
+        const ActivityConfig& getConfig() const { return config; }
+        const ActivityCounters& getCounters() const { return counters; }
+
+        // 프레임 시작 시 호출: 모든 객체의 등급 재분류
+        template<typename T>
+        void beginFrame(const std::vector<std::unique_ptr<T>>& objects, const Vector2D& playerPosition) {
+            ++frame;
+            tiers.resize(objects.size());
+            wakeFramesLeft.resize(objects.size(), 0);
+            wokenThisFrame.assign(objects.size(), 0);
+            counters = {0, 0, 0};
+
+            const float radiusSquared = config.interestRadius * config.interestRadius;
+            for (size_t i = 0; i < objects.size(); ++i) {
+                const GameObject* obj = objects[i].get();
+                ActivityTier tier = ActivityTier::ACTIVE;
+                if (wakeFramesLeft[i] > 0) {
+                    --wakeFramesLeft[i];    // 최근에 깨어난 객체는 조건과 관계없이 ACTIVE
+                } else if (config.enabled && obj) {
+                    const Vector2D& velocity = obj->getVelocity();
+                    float dx = obj->getPosition().x - playerPosition.x;
+                    float dy = obj->getPosition().y - playerPosition.y;
+                    if (velocity.x == 0 && velocity.y == 0 && dx * dx + dy * dy > radiusSquared) {
+                        tier = ActivityTier::DORMANT;
+                    }
+                }
+                tiers[i] = tier;
+                if (tier == ActivityTier::DORMANT) ++counters.dormant;
+                else ++counters.active;
+            }
+        }
+
+        // 충돌 등으로 즉시 깨우기 (이번 프레임에도 업데이트되고, 이후 wakeFrames 동안 ACTIVE 유지)
+        void wake(size_t slot) {
+            if (slot >= tiers.size()) return;
+            wakeFramesLeft[slot] = std::max(0, config.wakeFrames);
+            if (tiers[slot] == ActivityTier::ACTIVE) return;
+            tiers[slot] = ActivityTier::ACTIVE;
+            wokenThisFrame[slot] = 1;
+            --counters.dormant;
+            ++counters.active;
+        }
+
+        ActivityTier tierOf(size_t slot) const {
+            return slot < tiers.size() ? tiers[slot] : ActivityTier::ACTIVE;
+        }
+
+        // 이번 프레임에 slot을 업데이트할지 여부 (건너뛰면 skipped 증가)
+        bool shouldUpdate(size_t slot) {
+            if (!config.enabled || slot >= tiers.size() || wokenThisFrame[slot]) return true;
+            int interval = intervalOf(tiers[slot]);
+            if ((frame + slot) % interval == 0) return true;
+            ++counters.skipped;
+            return false;
+        }
+
+        // 건너뛴 프레임 시간을 보상한 deltaTime
+        float scaledDelta(size_t slot, float deltaTime) const {
+            if (!config.enabled || slot >= tiers.size() || wokenThisFrame[slot]) return deltaTime;
+            return deltaTime * intervalOf(tiers[slot]);
+        }
+    };
+
+    // 이름/ID -> gameObjects 슬롯 해시 색인
+    // 삭제는 비활성 표시 후 프레임 끝에 compact()로 한 번에 정리한다.
+    // 정리할 때 상대 순서를 유지하므로 충돌 이벤트 순서도 바뀌지 않는다.
+    class GameObjectIndex {
+    private:
+        std::unordered_map<std::string, std::set<size_t>> byName;  // 이름은 중복될 수 있어 슬롯을 정렬해 보관
+        std::unordered_map<int, size_t> byId;
+        std::vector<size_t> pendingRemovals;
+
+    public:
+        void clear() {
+            byName.clear();
+            byId.clear();
+            pendingRemovals.clear();
+        }
+
+        void add(const GameObject* obj, size_t slot) {
+            byName[obj->getName()].insert(slot);
+            byId[obj->getId()] = slot;
+        }
+
+        // 없으면 -1. 같은 이름이 여럿이면 가장 앞 슬롯 (기존 선형 탐색과 같은 결과)
+        long findByName(const std::string& name) const {
+            auto it = byName.find(name);
+            return it == byName.end() ? -1 : static_cast<long>(*it->second.begin());
+        }
+
+        long findById(int id) const {
+            auto it = byId.find(id);
+            return it == byId.end() ? -1 : static_cast<long>(it->second);
+        }
+
+        // 색인에서 즉시 제거하고 슬롯은 지연 정리 대상으로 기록
+        void markRemoved(const GameObject* obj, size_t slot) {
+            auto it = byName.find(obj->getName());
+            if (it != byName.end()) {
+                it->second.erase(slot);
+                if (it->second.empty()) byName.erase(it);
+            }
+            byId.erase(obj->getId());
+            pendingRemovals.push_back(slot);
+        }
+
+        bool hasPendingRemovals() const { return !pendingRemovals.empty(); }
+
+        // 표시된 슬롯을 제거하고 남은 객체들로 색인을 다시 만든다
+        template<typename T>
+        void compact(std::vector<std::unique_ptr<T>>& objects) {
+            if (pendingRemovals.empty()) return;
+
+            std::vector<bool> removed(objects.size(), false);
+            for (size_t slot : pendingRemovals) removed[slot] = true;
+            pendingRemovals.clear();
+
+            size_t write = 0;
+            for (size_t read = 0; read < objects.size(); ++read) {
+                if (!removed[read]) objects[write++] = std::move(objects[read]);
+            }
+            objects.resize(write);
+            rebuild(objects);
+        }
+
+        template<typename T>
+        void rebuild(const std::vector<std::unique_ptr<T>>& objects) {
+            byName.clear();
+            byId.clear();
+            for (size_t i = 0; i < objects.size(); ++i) {
+                add(objects[i].get(), i);
+            }
+        }
+
+        size_t size() const { return byId.size(); }
+    };
+
+    // 정렬-스윕(sort and sweep) 브로드 페이즈
+    // 객체의 x 구간 [x - r, x + r]을 minX 순으로 정렬해 두고 겹치는 구간만 쌍으로 만든다.
+    // 이전 프레임의 순서를 유지한 채 삽입 정렬하므로 움직임이 작으면 거의 O(n)이다.
+    // SpatialGrid와 같은 형식(i < j, 오름차순)의 후보 쌍을 돌려준다.
+    class SweepAndPrune {
+    private:
+        struct Entry {
+            float minX, maxX;
+            float y;
+            size_t slot;
+        };
+
+        float radius;
+        std::vector<Entry> entries;
+        std::vector<uint8_t> activeFlags;
+
+    public:
+        explicit SweepAndPrune(float r = 16.0f) : radius(r) {}
+
+        void setRadius(float r) { radius = r; }
+
+        template<typename T>
+        void update(const std::vector<std::unique_ptr<T>>& objects) {
+            // 사라진 슬롯 제거 후 기존 순서를 유지한 채 구간 갱신
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const Entry& e) {
+                return e.slot >= objects.size();
+            }), entries.end());
+
+            std::vector<uint8_t> present(objects.size(), 0);
+            for (auto& entry : entries) present[entry.slot] = 1;
+            for (size_t i = 0; i < objects.size(); ++i) {
+                if (!present[i]) entries.push_back({0, 0, 0, i});
+            }
+
+            // 빈 슬롯이나 비활성 객체는 이전 구간을 그대로 둔다 (collectPairs에서 activeFlags로 걸러짐)
+            for (auto& entry : entries) {
+                const T* obj = objects[entry.slot].get();
+                if (!obj || !obj->isActive()) continue;
+                const Vector2D& pos = obj->getPosition();
+                entry.minX = pos.x - radius;
+                entry.maxX = pos.x + radius;
+                entry.y = pos.y;
+            }
+
+            // 삽입 정렬: 프레임 간 순서 변화가 작다는 점을 이용
+            // 첫 프레임이나 대량 생성 직후처럼 많이 흐트러져 있으면 이동 횟수가 한도를 넘는 순간
+            // std::sort로 바꾼다 (삽입 정렬만 쓰면 O(n^2))
+            size_t moveBudget = entries.size() * 8;
+            bool sorted = true;
+            for (size_t i = 1; i < entries.size() && sorted; ++i) {
+                Entry moving = entries[i];
+                size_t j = i;
+                while (j > 0 && entries[j - 1].minX > moving.minX) {
+                    entries[j] = entries[j - 1];
+                    --j;
+                    if (moveBudget-- == 0) {
+                        sorted = false;
+                        break;
+                    }
+                }
+                entries[j] = moving;
+            }
+            if (!sorted) {
+                std::sort(entries.begin(), entries.end(),
+                          [](const Entry& a, const Entry& b) { return a.minX < b.minX; });
+            }
+
+            activeFlags.assign(objects.size(), 0);
+            for (size_t i = 0; i < objects.size(); ++i) {
+                activeFlags[i] = objects[i] && objects[i]->isActive();
+            }
+        }
+
+        void collectPairs(std::vector<std::pair<size_t, size_t>>& pairs) const {
+            pairs.clear();
+            for (size_t i = 0; i < entries.size(); ++i) {
+                const Entry& a = entries[i];
+                if (!activeFlags[a.slot]) continue;
+                for (size_t j = i + 1; j < entries.size() && entries[j].minX <= a.maxX; ++j) {
+                    const Entry& b = entries[j];
+                    if (!activeFlags[b.slot] || std::fabs(a.y - b.y) > 2 * radius) continue;
+                    pairs.emplace_back(std::min(a.slot, b.slot), std::max(a.slot, b.slot));
+                }
+            }
+            std::sort(pairs.begin(), pairs.end());
+        }
+    };
+
+    // 접촉 쌍 캐시
+    // 프레임마다 실제로 닿은 쌍(객체 id 기준)을 받아 직전 프레임과 비교하고
+    // ENTER/STAY/EXIT로 분류한다. 리스너는 상태가 바뀐 쌍만 받도록 고를 수 있다.
+    class ContactCache {
+    public:
+        struct Contact {
+            int id1, id2;   // id1 < id2
+
+            bool operator<(const Contact& other) const {
+                return id1 != other.id1 ? id1 < other.id1 : id2 < other.id2;
+            }
+            bool operator==(const Contact& other) const {
+                return id1 == other.id1 && id2 == other.id2;
+            }
+        };
+
+        struct Stats {
+            size_t entered, stayed, exited;
+        };
+
+    private:
+        std::vector<Contact> previous;
+        std::vector<Contact> current;
+        Stats stats;
+
+    public:
+        ContactCache() : stats{0, 0, 0} {}
+
+        void beginFrame() { current.clear(); }
+
+        void addContact(int idA, int idB) {
+            current.push_back({std::min(idA, idB), std::max(idA, idB)});
+        }
+
+        // 직전 프레임과 병합 비교. onChange(contact, phase)를 id 순서로 호출
+        template<typename Fn>
+        void endFrame(Fn&& onChange) {
+            std::sort(current.begin(), current.end());
+            current.erase(std::unique(current.begin(), current.end()), current.end());
+
+            stats = {0, 0, 0};
+            size_t a = 0, b = 0;
+            while (a < previous.size() || b < current.size()) {
+                if (b == current.size() || (a < previous.size() && previous[a] < current[b])) {
+                    onChange(previous[a++], ContactPhase::EXIT);
+                    ++stats.exited;
+                } else if (a == previous.size() || current[b] < previous[a]) {
+                    onChange(current[b++], ContactPhase::ENTER);
+                    ++stats.entered;
+                } else {
+                    onChange(current[b], ContactPhase::STAY);
+                    ++stats.stayed;
+                    ++a;
+                    ++b;
+                }
+            }
+            previous.swap(current);
+        }
+
+        // 객체가 제거되면 EXIT 없이 바로 잊기
+        void forget(int id) {
+            previous.erase(std::remove_if(previous.begin(), previous.end(), [id](const Contact& c) {
+                return c.id1 == id || c.id2 == id;
+            }), previous.end());
+        }
+
+        const Stats& getStats() const { return stats; }
+        size_t size() const { return previous.size(); }
+        void clear() { previous.clear(); current.clear(); }
+    };
+
+    // 브로드 페이즈 종류
+    enum class BroadPhase {
+        GRID,               // SpatialGrid (기본)
+        SWEEP_AND_PRUNE     // 프레임 간 일관성을 이용하는 정렬-스윕
+    };
+
+    // 게임 월드 관리자
+    class GameWorld {
+    private:
+        std::vector<std::unique_ptr<GameObject>> gameObjects;
+        std::unique_ptr<Player> player;
+        GameState currentState;
+        float worldWidth, worldHeight;
+
+        // 충돌 브로드 페이즈
+        SpatialGrid collisionGrid;
+        std::vector<std::pair<size_t, size_t>> candidatePairs;
+        size_t pairsTestedLastFrame;
+        BroadPhase broadPhase;
+        SweepAndPrune sweepAndPrune;
+
+        // 접촉 쌍 캐시 (켜면 STAY 이벤트는 reportStayContacts일 때만 방송)
+        bool contactCacheEnabled;
+        bool reportStayContacts;
+        ContactCache contactCache;
+
+        // 병렬 업데이트 (workerCount == 1이면 기존 직렬 경로)
+        std::unique_ptr<JobSystem> jobSystem;
+        size_t updateChunkSize;
+        DeferredEvents<CollisionEvent> deferredCollisions;
+        DeferredEvents<ScoreEvent> deferredScores;
+
+        // 이름/ID 색인 (add/remove/cleanup 시 함께 갱신)
+        GameObjectIndex objectIndex;
+
+        // 휴면 객체 선별 (update에서 등급별 빈도로 건너뜀)
+        ActivityManager activity;
+
+        // SoA 저장 모드
+        StorageMode storageMode;
+        EntityStorage entityStorage;
+
+        // 이벤트 시스템
+        EventSystem<CollisionEvent> collisionEvents;
+        EventSystem<ScoreEvent> scoreEvents;
+
+        // 랜덤 생성기
+        std::random_device rd;
+        std::mt19937 gen;
+        std::uniform_real_distribution<float> posDist;
+
+        // 헤드리스 모드: render()가 아무것도 출력하지 않음 (서버 측 시뮬레이션용)
+        bool headless;
+
+    public:
+        GameWorld(float width = 800, float height = 600);
+        ~GameWorld() = default;
+
+        // 게임 오브젝트 관리 (색인으로 O(1) 탐색, 없으면 GameObjectNotFoundException)
+        void addGameObject(std::unique_ptr<GameObject> obj);
+        void removeGameObject(const std::string& name);
+        GameObject* findGameObject(const std::string& name);
+        GameObject* findGameObjectById(int id);
+
+        // 프레임 끝에서 삭제 표시된 객체 정리
+        void compactRemovedObjects();
+
+        // 플레이어 관리
+        void setPlayer(std::unique_ptr<Player> p);
+        Player* getPlayer() const { return player.get(); }
+
+        // 게임 루프
+        void update(float deltaTime);
+        void render() const;
+        void render(float alpha) const;     // 보간된 위치로 렌더
+        void storePreviousState();          // 모든 객체의 직전 틱 상태 저장
+
+        // 활동 등급 설정과 현재 ACTIVE/DORMANT 개수
+        void setActivityConfig(const ActivityConfig& config) { activity.setConfig(config); }
+        const ActivityCounters& getActivityCounters() const { return activity.getCounters(); }
+
+        // 병렬 업데이트 설정
+        // 객체 업데이트와 충돌 브로드 페이즈를 청크로 나눠 실행하고,
+        // 그동안 생긴 이벤트는 DeferredEvents에 모았다가 청크 순서대로 재생한다.
+        void setWorkerCount(size_t count);
+        size_t getWorkerCount() const { return jobSystem ? jobSystem->getWorkerCount() : 1; }
+        void setUpdateChunkSize(size_t size) { updateChunkSize = std::max<size_t>(1, size); }
+        void flushDeferredEvents();
+
+        // SoA 저장 모드 (gameObjects는 그대로 두고 핸들로 사용)
+        void setStorageMode(StorageMode mode);
+        StorageMode getStorageMode() const { return storageMode; }
+        void rebuildEntityStorage();
+
+        // 타입별 배치 시스템 (SoA 모드의 update에서 사용)
+        void updatePlayerSystem(float deltaTime);
+        void updateEnemySystem(float deltaTime);
+        void updateItemSystem(float deltaTime);
+
+        // 충돌 검사 (격자로 후보 쌍을 추린 뒤 checkCollision으로 정밀 검사)
+        // 작업자가 둘 이상이면 후보 쌍은 청크별로 병렬 수집해 청크 순서로 합친다 (직렬과 같은 순서)
         void checkCollisions();
+        void rebuildCollisionGrid();
+        size_t getPairsTestedLastFrame() const { return pairsTestedLastFrame; }
+        void setBroadPhase(BroadPhase phase) { broadPhase = phase; }
+        BroadPhase getBroadPhase() const { return broadPhase; }
+
+        // 접촉 쌍 캐시: ENTER/EXIT(선택적으로 STAY) 이벤트만 방송하고
+        // onCollision도 ENTER 때만 호출
+        void setContactCache(bool enabled, bool reportStay = false);
+        const ContactCache::Stats& getContactStats() const { return contactCache.getStats(); }
 
         // 게임 상태 관리
         void setState(GameState state) { currentState = state; }
@@ -271,6 +2326,14 @@ namespace GameEngine {
         // 월드 경계 검사
         bool isInBounds(const Vector2D& position) const;
         void clampToBounds(Vector2D& position) const;
+        void clampAllToBounds();    // SoA 모드: VectorBatch::clampToBounds로 전체 처리
+
+        // 관전자 스트림: 이번 틱의 델타를 out에 덧붙임
+        void encodeDelta(DeltaEncoder& encoder, std::vector<uint8_t>& out) const;
+
+        // 스냅샷 저장/복원 (WorldSnapshot 형식, 플레이어 + 모든 객체 + GameState)
+        void saveSnapshot(const std::string& filename) const;
+        void loadSnapshot(const std::string& filename);
 
         // 적과 아이템 생성
         void spawnEnemy();
@@ -278,16 +2341,400 @@ namespace GameEngine {
 
         // 이벤트 리스너 등록
         void addCollisionListener(std::function<void(const CollisionEvent&)> listener);
+        void addCollisionListener(std::function<void(const CollisionEvent&)> listener,
+                                  std::function<bool(const CollisionEvent&)> filter);
         void addScoreListener(std::function<void(const ScoreEvent&)> listener);
 
-        // 게임 통계
+        // 이벤트 큐 모드 (update 끝에서 dispatchEvents로 한꺼번에 전달)
+        void enableEventQueues(size_t capacity = 4096);
+        void dispatchEvents();
+
+        // 게임 통계 (Enemy/Item 풀의 live/peak/free 포함)
         void displayStatistics() const;
+        void displayPoolStatistics() const;
+
+        // 헤드리스/결정적 실행
+        void setHeadless(bool enabled) { headless = enabled; }
+        bool isHeadless() const { return headless; }
+        void setSeed(uint32_t seed) { gen.seed(seed); }    // random_device 대신 고정 시드
+        void applyInput(uint8_t buttons, float deltaTime);  // InputButton 비트로 플레이어 이동
+
+        // 결정성 비교용 상태 해시 (FNV-1a: 플레이어와 모든 객체의 id, 이름, 위치, 속도, 활성 여부)
+        uint64_t computeStateHash() const;
 
         // 게임 초기화 및 정리
         void initialize();
         void cleanup();
     };
 
+    // 입력 버튼 비트
+    enum InputButton : uint8_t {
+        INPUT_UP = 1 << 0,
+        INPUT_DOWN = 1 << 1,
+        INPUT_LEFT = 1 << 2,
+        INPUT_RIGHT = 1 << 3
+    };
+
+    // 틱별 입력 기록 (값이 바뀐 틱만 저장)
+    // 시드와 함께 저장해 두면 같은 실행을 비트 단위로 똑같이 재생할 수 있다.
+    class InputRecording {
+    public:
+        struct Entry {
+            uint64_t tick;
+            uint8_t buttons;
+        };
+
+    private:
+        uint32_t seed;
+        std::vector<Entry> entries;
+
+    public:
+        explicit InputRecording(uint32_t s = 0) : seed(s) {}
+
+        uint32_t getSeed() const { return seed; }
+        size_t size() const { return entries.size(); }
+
+        void record(uint64_t tick, uint8_t buttons) {
+            if (entries.empty() || entries.back().buttons != buttons) {
+                entries.push_back({tick, buttons});
+            }
+        }
+
+        // tick 시점의 입력 (기록된 변화 중 tick 이하인 마지막 값)
+        uint8_t buttonsAt(uint64_t tick) const {
+            auto it = std::upper_bound(entries.begin(), entries.end(), tick,
+                [](uint64_t t, const Entry& e) { return t < e.tick; });
+            return it == entries.begin() ? 0 : (it - 1)->buttons;
+        }
+
+        void save(std::ostream& out) const {
+            uint64_t count = entries.size();
+            out.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
+            out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            for (const auto& entry : entries) {
+                out.write(reinterpret_cast<const char*>(&entry.tick), sizeof(entry.tick));
+                out.write(reinterpret_cast<const char*>(&entry.buttons), sizeof(entry.buttons));
+            }
+        }
+
+        void load(std::istream& in) {
+            uint64_t count = 0;
+            in.read(reinterpret_cast<char*>(&seed), sizeof(seed));
+            in.read(reinterpret_cast<char*>(&count), sizeof(count));
+            entries.clear();
+            for (uint64_t i = 0; i < count && in; ++i) {
+                Entry entry;
+                in.read(reinterpret_cast<char*>(&entry.tick), sizeof(entry.tick));
+                in.read(reinterpret_cast<char*>(&entry.buttons), sizeof(entry.buttons));
+                entries.push_back(entry);
+            }
+            if (!in) throw GameException("입력 기록을 읽을 수 없음");
+        }
+    };
+
+    // 헤드리스 배치 시뮬레이션
+    // 월드 N개를 고정 시드로 만들어 순서대로 또는 JobSystem으로 병렬 실행한다.
+    // 렌더링 없이 고정 deltaTime으로만 진행하므로 같은 시드와 입력이면 결과가 같다.
+    class SimulationRunner {
+    public:
+        struct Config {
+            size_t worldCount = 1;
+            uint64_t ticks = 1000;
+            float tickDelta = 1.0f / 60.0f;
+            uint32_t baseSeed = 12345;      // 월드 i의 시드 = baseSeed + i
+            size_t threads = 1;
+        };
+
+        struct Result {
+            uint64_t totalTicks;
+            double seconds;
+            double ticksPerSecondPerCore;
+            std::vector<uint64_t> stateHashes;  // 월드별 마지막 상태 (GameWorld::computeStateHash)
+        };
+
+        // (월드 번호, 틱) -> 입력 버튼. 비어 있으면 입력 없음
+        using InputSource = std::function<uint8_t(size_t, uint64_t)>;
+
+        // recordings가 있으면 월드별 입력을 기록 (replay에 사용)
+        static Result run(const Config& config, const InputSource& input = nullptr,
+                          std::vector<InputRecording>* recordings = nullptr) {
+            if (recordings) {
+                recordings->clear();
+                for (size_t w = 0; w < config.worldCount; ++w) {
+                    recordings->emplace_back(config.baseSeed + static_cast<uint32_t>(w));
+                }
+            }
+
+            std::vector<uint64_t> stateHashes(config.worldCount);
+            auto simulateWorld = [&](size_t w) {
+                int nextObjectId = 0;   // 월드마다 0부터: 실행 순서나 스레드와 무관하게 같은 id
+                GameObject::IdScope ids(nextObjectId);
+                GameWorld world;
+                world.setHeadless(true);
+                world.setSeed(config.baseSeed + static_cast<uint32_t>(w));
+                world.initialize();
+                for (uint64_t tick = 0; tick < config.ticks; ++tick) {
+                    uint8_t buttons = input ? input(w, tick) : 0;
+                    if (recordings) (*recordings)[w].record(tick, buttons);
+                    world.applyInput(buttons, config.tickDelta);
+                    world.update(config.tickDelta);
+                }
+                stateHashes[w] = world.computeStateHash();
+                world.cleanup();
+            };
+
+            auto start = std::chrono::steady_clock::now();
+            if (config.threads <= 1) {
+                for (size_t w = 0; w < config.worldCount; ++w) simulateWorld(w);
+            } else {
+                JobSystem jobs(config.threads);
+                jobs.parallelFor(config.worldCount, 1, [&](size_t begin, size_t end, size_t) {
+                    for (size_t w = begin; w < end; ++w) simulateWorld(w);
+                });
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            uint64_t totalTicks = config.ticks * config.worldCount;
+            size_t cores = std::max<size_t>(1, std::min(config.threads, config.worldCount));
+            return {totalTicks, seconds, seconds > 0 ? totalTicks / seconds / cores : 0.0, std::move(stateHashes)};
+        }
+
+        // 기록된 입력으로 월드 하나를 다시 실행. 결과 월드를 호출자에게 넘겨 비교할 수 있게 한다.
+        static std::unique_ptr<GameWorld> replay(const InputRecording& recording, uint64_t ticks,
+                                                 float tickDelta = 1.0f / 60.0f) {
+            int nextObjectId = 0;       // run과 같은 id 범위
+            GameObject::IdScope ids(nextObjectId);
+            auto world = std::make_unique<GameWorld>();
+            world->setHeadless(true);
+            world->setSeed(recording.getSeed());
+            world->initialize();
+            for (uint64_t tick = 0; tick < ticks; ++tick) {
+                world->applyInput(recording.buttonsAt(tick), tickDelta);
+                world->update(tickDelta);
+            }
+            return world;
+        }
+
+        // 결정성 검사: config대로 run한 뒤 각 월드를 replay해서 상태 해시가 같은지 비교
+        // 다른 월드가 있으면 그 번호를 mismatches에 담고 false 반환
+        static bool verifyReplay(const Config& config, const InputSource& input = nullptr,
+                                 std::vector<size_t>* mismatches = nullptr) {
+            std::vector<InputRecording> recordings;
+            Result result = run(config, input, &recordings);
+            bool identical = true;
+            for (size_t w = 0; w < config.worldCount; ++w) {
+                auto world = replay(recordings[w], config.ticks, config.tickDelta);
+                if (world->computeStateHash() != result.stateHashes[w]) {
+                    identical = false;
+                    if (mismatches) mismatches->push_back(w);
+                }
+                world->cleanup();
+            }
+            return identical;
+        }
+    };
+
+    // 고정 시간 간격 누적기
+    // 프레임 시간을 누적해서 step 단위 틱으로 잘라 준다. 한 프레임에 maxTicksPerFrame을
+    // 넘는 틱은 버리고(droppedTicks) 따라잡지 않으므로 "죽음의 나선"을 피한다.
+    class FixedTimestep {
+    private:
+        double step;
+        double accumulator;
+        int maxTicksPerFrame;
+        uint64_t totalTicks;
+        uint64_t droppedTicks;
+
+    public:
+        explicit FixedTimestep(float tickRate = 60.0f, int maxTicks = 5)
+            : step(stepFor(tickRate)), accumulator(0), maxTicksPerFrame(std::max(1, maxTicks)),
+              totalTicks(0), droppedTicks(0) {}
+
+        // 0 이하(또는 NaN)이면 step이 무한대나 음수가 되므로 거부
+        void setTickRate(float tickRate) { step = stepFor(tickRate); }
+        void setMaxTicksPerFrame(int maxTicks) { maxTicksPerFrame = std::max(1, maxTicks); }
+
+        // frameTime을 누적하고 이번 프레임에 실행할 틱 수 반환
+        int advance(float frameTime) {
+            accumulator += frameTime;
+            int ticks = static_cast<int>(accumulator / step);
+            if (ticks > maxTicksPerFrame) {
+                droppedTicks += ticks - maxTicksPerFrame;
+                ticks = maxTicksPerFrame;
+                accumulator = step * ticks;     // 남은 지연은 버림
+            }
+            accumulator -= step * ticks;
+            totalTicks += ticks;
+            return ticks;
+        }
+
+        // 렌더 보간 계수 (0 ~ 1)
+        float getAlpha() const { return static_cast<float>(accumulator / step); }
+        float getStep() const { return static_cast<float>(step); }
+        float getTickRate() const { return static_cast<float>(1.0 / step); }
+        uint64_t getTotalTicks() const { return totalTicks; }
+        uint64_t getDroppedTicks() const { return droppedTicks; }
+
+    private:
+        static double stepFor(float tickRate) {
+            if (!(tickRate > 0) || std::isinf(tickRate)) {
+                throw GameException("틱 속도는 0보다 큰 유한한 값이어야 함: " + std::to_string(tickRate));
+            }
+            return 1.0 / tickRate;
+        }
+    };
+
+    // 프레임 프로파일러
+    // 이름 붙은 구간(zone)마다 최근 SampleCount개 측정값을 링 버퍼에 보관하고
+    // p50/p99/max 통계와 Chrome trace-event JSON(chrome://tracing) 내보내기를 제공한다.
+    // 게임 루프 스레드에서만 기록한다고 가정한다.
+    class Profiler {
+    public:
+        static constexpr size_t SampleCount = 256;
+
+        struct Sample {
+            uint64_t startMicros;
+            uint64_t durationNanos;
+        };
+
+        struct ZoneStats {
+            double p50Micros;
+            double p99Micros;
+            double maxMicros;
+            size_t samples;
+        };
+
+    private:
+        struct Zone {
+            const char* name;
+            Sample samples[SampleCount];
+            size_t next = 0;
+            size_t count = 0;
+        };
+
+        std::vector<std::unique_ptr<Zone>> zones;
+        std::chrono::steady_clock::time_point origin;
+
+        Profiler() : origin(std::chrono::steady_clock::now()) {}
+
+    public:
+        static Profiler& instance() {
+            static Profiler profiler;
+            return profiler;
+        }
+
+        // 호출 지점마다 한 번만 등록 (PROFILE_ZONE이 static 변수로 캐시)
+        size_t registerZone(const char* name) {
+            zones.push_back(std::make_unique<Zone>());
+            zones.back()->name = name;
+            return zones.size() - 1;
+        }
+
+        void record(size_t zoneId, std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point end) {
+            Zone& zone = *zones[zoneId];
+            Sample& sample = zone.samples[zone.next];
+            sample.startMicros = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(start - origin).count());
+            sample.durationNanos = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            zone.next = (zone.next + 1) % SampleCount;
+            zone.count = std::min(zone.count + 1, SampleCount);
+        }
+
+        ZoneStats getStats(size_t zoneId) const {
+            const Zone& zone = *zones[zoneId];
+            if (zone.count == 0) return {0, 0, 0, 0};
+
+            std::vector<uint64_t> durations;
+            durations.reserve(zone.count);
+            for (size_t i = 0; i < zone.count; ++i) {
+                durations.push_back(zone.samples[i].durationNanos);
+            }
+            std::sort(durations.begin(), durations.end());
+
+            auto percentile = [&](double p) {
+                size_t index = static_cast<size_t>(p * (durations.size() - 1) + 0.5);
+                return durations[index] / 1000.0;
+            };
+            return {percentile(0.50), percentile(0.99), durations.back() / 1000.0, zone.count};
+        }
+
+        void report(std::ostream& out) const {
+            out << "=== 프로파일 (최근 " << SampleCount << " 샘플, 단위 us) ===" << std::endl;
+            for (size_t i = 0; i < zones.size(); ++i) {
+                ZoneStats stats = getStats(i);
+                out << zones[i]->name << ": p50=" << stats.p50Micros
+                    << " p99=" << stats.p99Micros << " max=" << stats.maxMicros
+                    << " (n=" << stats.samples << ")" << std::endl;
+            }
+        }
+
+        // Chrome trace-event 형식 ("X" 완료 이벤트)
+        void exportChromeTrace(std::ostream& out) const {
+            out << "{\"traceEvents\":[";
+            bool first = true;
+            for (const auto& zone : zones) {
+                size_t oldest = zone->count < SampleCount ? 0 : zone->next;
+                for (size_t i = 0; i < zone->count; ++i) {
+                    const Sample& sample = zone->samples[(oldest + i) % SampleCount];
+                    if (!first) out << ",";
+                    first = false;
+                    out << "{\"name\":";
+                    writeJsonString(out, zone->name);
+                    out << ",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                        << ",\"ts\":" << sample.startMicros
+                        << ",\"dur\":" << sample.durationNanos / 1000.0 << "}";
+                }
+            }
+            out << "]}" << std::endl;
+        }
+
+    private:
+        // JSON 문자열 리터럴로 출력 (따옴표, 역슬래시, 제어 문자 이스케이프)
+        static void writeJsonString(std::ostream& out, const char* text) {
+            out << '"';
+            for (const char* p = text; *p; ++p) {
+                unsigned char c = static_cast<unsigned char>(*p);
+                if (c == '"' || c == '\\') {
+                    out << '\\' << *p;
+                } else if (c < 0x20) {
+                    const char* hex = "0123456789abcdef";
+                    out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+                } else {
+                    out << *p;
+                }
+            }
+            out << '"';
+        }
+    };
+
+    // 범위를 벗어날 때 경과 시간을 기록하는 RAII 타이머
+    class ScopedTimer {
+    private:
+        size_t zoneId;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit ScopedTimer(size_t zone) : zoneId(zone), start(std::chrono::steady_clock::now()) {}
+        ~ScopedTimer() { Profiler::instance().record(zoneId, start, std::chrono::steady_clock::now()); }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    };
+
+    // 프로파일링 매크로 (GAME_ENGINE_PROFILING이 정의되지 않으면 코드가 완전히 사라짐)
+#define GAME_ENGINE_CONCAT_IMPL(a, b) a##b
+#define GAME_ENGINE_CONCAT(a, b) GAME_ENGINE_CONCAT_IMPL(a, b)
+#ifdef GAME_ENGINE_PROFILING
+    #define PROFILE_ZONE(name) \
+        static const size_t GAME_ENGINE_CONCAT(profileZone_, __LINE__) = \
+            ::GameEngine::Profiler::instance().registerZone(name); \
+        ::GameEngine::ScopedTimer GAME_ENGINE_CONCAT(profileTimer_, __LINE__)(GAME_ENGINE_CONCAT(profileZone_, __LINE__))
+#else
+    #define PROFILE_ZONE(name)
+#endif
+
     // 게임 엔진 메인 클래스
     class Game {
     private:
@@ -295,10 +2742,15 @@ namespace GameEngine {
         bool running;
         std::chrono::high_resolution_clock::time_point lastFrameTime;
 
+        // 고정 틱 모드 (꺼져 있으면 가변 deltaTime을 그대로 사용)
+        bool fixedTimestepEnabled;
+        FixedTimestep timestep;
+
         // 성능 측정
         int frameCount;
         float totalTime;
         float averageFPS;
+        float averageTickRate;      // 초당 실제 실행된 틱 수
 
     public:
         Game();
@@ -314,10 +2766,17 @@ namespace GameEngine {
         void update(float deltaTime);
         void render();
 
+        // 고정 틱 설정
+        void setFixedTimestep(bool enabled, float tickRate = 60.0f, int maxTicksPerFrame = 5);
+        bool isFixedTimestep() const { return fixedTimestepEnabled; }
+
         // 유틸리티
         float calculateDeltaTime();
         void updateFPS(float deltaTime);
-        void displayFPS() const;
+        void updateTickRate(int ticks, float deltaTime);
+        void displayFPS() const;    // 프레임 수, 틱 수, 버린 틱 수를 따로 출력
+        void displayProfile() const;                            // 구간별 p50/p99/max
+        void exportProfile(const std::string& filename) const;  // Chrome trace JSON
 
         bool isRunning() const { return running; }
         void stop() { running = false; }